@@ -0,0 +1,91 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/buffered_hasher.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/core/type_name.hpp>
+#include <chrono>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <cstdio>
+
+// hash_append produces an update call per member of a composite type;
+// compares the plain algorithm against buffered_hasher, which coalesces them
+
+using tuple_type = std::tuple<
+    char, short, int, long long, char, short, int, long long, float, double,
+    char, short, int, long long, char, short, int, long long, float, double
+>;
+
+template<class Hash, class T> void test_( char const* name, T const& v, int N, int M )
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    clock_type::time_point t1 = clock_type::now();
+
+    unsigned r = 0;
+
+    for( int i = 0; i < M; ++i )
+    {
+        Hash h( i );
+        boost::hash2::hash_append( h, {}, v );
+
+        r += boost::hash2::get_integral_result<unsigned>( h );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    long long ms = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
+
+    std::printf( "%s, %s: %u: %lld ms, %.2f MB/s\n", boost::core::type_name<Hash>().c_str(), name, r, ms, 1000.0 * N * M / ms / 1048576 );
+}
+
+template<class Hash, class T> void test2( char const* name, T const& v, int N, int M )
+{
+    test_<Hash>( name, v, N, M );
+    test_< boost::hash2::buffered_hasher<Hash> >( name, v, N, M );
+}
+
+template<class T> void test( char const* name, T const& v, int N, int M )
+{
+    using namespace boost::hash2;
+
+    test2<fnv1a_64>( name, v, N, M );
+    test2<xxhash_64>( name, v, N, M );
+    test2<xxh3_128>( name, v, N, M );
+    test2<siphash_64>( name, v, N, M );
+    test2<sha2_256>( name, v, N, M );
+
+    puts( "--" );
+}
+
+int main()
+{
+    {
+        tuple_type v{};
+        int N = 2 * ( 1 + 2 + 4 + 8 + 1 + 2 + 4 + 8 + 4 + 8 );
+
+        test( "tuple<...> (20 members)", v, N, 1 << 20 );
+    }
+
+    {
+        std::vector< std::pair<int, short> > v;
+
+        for( int i = 0; i < 1024; ++i )
+        {
+            v.push_back( { i, static_cast<short>( i ) } );
+        }
+
+        int N = 1024 * 6 + 8;
+
+        test( "vector<pair<int, short>> (1024 elements)", v, N, 1 << 12 );
+    }
+}
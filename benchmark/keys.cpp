@@ -8,8 +8,7 @@
 #include <boost/hash2/siphash.hpp>
 #include <boost/hash2/xxhash.hpp>
 #include <boost/hash2/xxh3.hpp>
-#include <boost/hash2/hash_append.hpp>
-#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/hash.hpp>
 #include <boost/core/type_name.hpp>
 #include <cstdint>
 #include <chrono>
@@ -22,48 +21,6 @@
 
 #define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
 
-template<class T, class H> class hasher
-{
-private:
-
-    H h_;
-
-private:
-
-    template<class = void> static void hash_append_impl( H& h, T const& v, std::false_type )
-    {
-        boost::hash2::hash_append( h, {}, v );
-    }
-
-    template<class = void> static void hash_append_impl( H& h, T const& v, std::true_type )
-    {
-        boost::hash2::hash_append_range( h, {}, v.data(), v.data() + v.size() );
-    }
-
-public:
-
-    hasher(): h_()
-    {
-    }
-
-    explicit hasher( std::uint64_t seed ): h_( seed )
-    {
-    }
-
-    hasher( unsigned char const* seed, std::size_t n ): h_( seed, n )
-    {
-    }
-
-    std::size_t operator()( T const& v ) const
-    {
-        H h( h_ );
-
-        hash_append_impl( h, v, boost::container_hash::is_contiguous_range<T>() );
-
-        return boost::hash2::get_integral_result<std::size_t>( h );
-    }
-};
-
 template<class H, class V> void test3( int N, V const& v, std::size_t seed )
 {
     typedef std::chrono::steady_clock clock_type;
@@ -72,7 +29,7 @@ template<class H, class V> void test3( int N, V const& v, std::size_t seed )
 
     std::size_t q = 0;
 
-    hasher<std::string, H> const h( seed );
+    boost::hash2::hash<std::string, H> const h( seed );
 
     for( int i = 0; i < N; ++i )
     {
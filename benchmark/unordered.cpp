@@ -9,8 +9,7 @@
 #include <boost/hash2/xxhash.hpp>
 #include <boost/hash2/xxh3.hpp>
 #include <boost/hash2/md5.hpp>
-#include <boost/hash2/hash_append.hpp>
-#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/hash.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <boost/core/type_name.hpp>
 #include <cstdint>
@@ -21,83 +20,6 @@
 #include <cstdio>
 #include <string>
 #include <vector>
-#include <type_traits>
-
-namespace detail
-{
-
-template<class Hash, class T> inline void compute_hash_value_impl( Hash& h, T const& v, std::false_type )
-{
-    boost::hash2::hash_append( h, {}, v );
-}
-
-template<class Hash, class T> inline void compute_hash_value_impl( Hash& h, T const& v, std::true_type )
-{
-    boost::hash2::hash_append_range( h, {}, v.data(), v.data() + v.size() );
-}
-
-template<class Hash, class T> inline std::size_t compute_hash_value( Hash& h, T const& v )
-{
-    detail::compute_hash_value_impl( h, v, boost::container_hash::is_contiguous_range<T>() );
-    return boost::hash2::get_integral_result<std::size_t>( h );
-}
-
-} // namespace detail
-
-template<class T, class H> class hash_without_seed
-{
-public:
-
-    using is_avalanching = std::true_type;
-
-    std::size_t operator()( T const& v ) const
-    {
-        H h;
-        return detail::compute_hash_value( h, v );
-    }
-};
-
-template<class T, class H> class hash_with_uint64_seed
-{
-private:
-
-    std::uint64_t seed_;
-
-public:
-
-    using is_avalanching = std::true_type;
-
-    explicit hash_with_uint64_seed( std::uint64_t seed ): seed_( seed )
-    {
-    }
-
-    std::size_t operator()( T const& v ) const
-    {
-        H h( seed_ );
-        return detail::compute_hash_value( h, v );
-    }
-};
-
-template<class T, class H> class hash_with_byte_seed
-{
-private:
-
-    H h_;
-
-public:
-
-    using is_avalanching = std::true_type;
-
-    hash_with_byte_seed( unsigned char const* seed, std::size_t n ): h_( seed, n )
-    {
-    }
-
-    std::size_t operator()( T const& v ) const
-    {
-        H h( h_ );
-        return detail::compute_hash_value( h, v );
-    }
-};
 
 template<class V, class S> BOOST_NOINLINE void test4( int N, V const& v, char const * hash, S s )
 {
@@ -134,7 +56,7 @@ template<class K, class H, class V> void test2( int N, V const& v )
     {
         std::string name = boost::core::type_name<H>() + " without seed";
 
-        using hash = hash_without_seed<K, H>;
+        using hash = boost::hash2::hash<K, H>;
         boost::unordered_flat_set<K, hash> s( 0, hash() );
 
         test4( N, v, name.c_str(), s );
@@ -145,7 +67,7 @@ template<class K, class H, class V> void test2( int N, V const& v )
 
         std::string name = boost::core::type_name<H>() + " with uint64 seed";
 
-        using hash = hash_with_uint64_seed<K, H>;
+        using hash = boost::hash2::hash<K, H>;
         boost::unordered_flat_set<K, hash> s( 0, hash( seed ) );
 
         test4( N, v, name.c_str(), s );
@@ -156,7 +78,7 @@ template<class K, class H, class V> void test2( int N, V const& v )
 
         std::string name = boost::core::type_name<H>() + " with byte seed";
 
-        using hash = hash_with_byte_seed<K, H>;
+        using hash = boost::hash2::hash<K, H>;
         boost::unordered_flat_set<K, hash> s( 0, hash( seed, sizeof(seed) ) );
 
         test4( N, v, name.c_str(), s );
@@ -0,0 +1,413 @@
+#ifndef BOOST_HASH2_BINARY_FUSE_FILTER_HPP_INCLUDED
+#define BOOST_HASH2_BINARY_FUSE_FILTER_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Binary fuse filters
+//
+// Thomas Mueller Graf, Daniel Lemire, Binary Fuse Filters: Fast and
+// Smaller Than Xor Filters, ACM Journal of Experimental Algorithmics 27
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/sketch_hasher.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<int Bits> struct fuse_fingerprint;
+
+template<> struct fuse_fingerprint<8>
+{
+    using type = std::uint8_t;
+};
+
+template<> struct fuse_fingerprint<16>
+{
+    using type = std::uint16_t;
+};
+
+template<> struct fuse_fingerprint<32>
+{
+    using type = std::uint32_t;
+};
+
+// the number of keys whose hash values are computed, and
+// whose fingerprints are prefetched, before they are queried
+constexpr std::size_t fuse_batch_size = 16;
+
+} // namespace detail
+
+template<class T, class Hash, int FingerprintBits = 8, class Flavor = default_flavor> class binary_fuse_filter: private detail::sketch_hasher<T, Hash, Flavor>
+{
+private:
+
+    using base = detail::sketch_hasher<T, Hash, Flavor>;
+
+public:
+
+    using fingerprint_type = typename detail::fuse_fingerprint<FingerprintBits>::type;
+
+private:
+
+    std::uint64_t seed_ = 0;
+
+    std::uint32_t segment_length_ = 0;
+    std::uint32_t segment_count_length_ = 0;
+
+    std::vector<fingerprint_type> fp_;
+
+private:
+
+    // the three positions are in three consecutive segments; the first
+    // segment is selected by the high bits of h, the offsets within the
+    // segments by its low bits
+
+    void positions( std::uint64_t h, std::uint32_t (&p)[ 3 ] ) const noexcept
+    {
+        std::uint32_t const mask = segment_length_ - 1;
+
+        p[ 0 ] = static_cast<std::uint32_t>( detail::mul128( h, segment_count_length_ ).high );
+        p[ 1 ] = ( p[ 0 ] + segment_length_ ) ^ ( static_cast<std::uint32_t>( h >> 18 ) & mask );
+        p[ 2 ] = ( p[ 0 ] + 2 * segment_length_ ) ^ ( static_cast<std::uint32_t>( h ) & mask );
+    }
+
+    static fingerprint_type fingerprint( std::uint64_t h ) noexcept
+    {
+        return static_cast<fingerprint_type>( h ^ ( h >> 32 ) );
+    }
+
+    bool contains_hash( std::uint64_t h ) const noexcept
+    {
+        std::uint32_t p[ 3 ];
+        positions( h, p );
+
+        fingerprint_type const* f = fp_.data();
+
+        return static_cast<fingerprint_type>( fingerprint( h ) ^ f[ p[ 0 ] ] ^ f[ p[ 1 ] ] ^ f[ p[ 2 ] ] ) == 0;
+    }
+
+    void prefetch_hash( std::uint64_t h ) const noexcept
+    {
+        std::uint32_t p[ 3 ];
+        positions( h, p );
+
+        detail::prefetch( fp_.data() + p[ 0 ] );
+        detail::prefetch( fp_.data() + p[ 1 ] );
+        detail::prefetch( fp_.data() + p[ 2 ] );
+    }
+
+    void init( std::size_t n, std::size_t extra_segments )
+    {
+        // the parameters of the reference implementation for arity 3
+
+        if( n <= 1 )
+        {
+            segment_length_ = 4;
+        }
+        else
+        {
+            int k = static_cast<int>( std::floor( std::log( static_cast<double>( n ) ) / std::log( 3.33 ) + 2.25 ) );
+            segment_length_ = std::uint32_t( 1 ) << ( std::min )( k, 18 );
+        }
+
+        std::size_t capacity = 0;
+
+        if( n > 1 )
+        {
+            double factor = ( std::max )( 1.125, 0.875 + 0.25 * std::log( 1000000.0 ) / std::log( static_cast<double>( n ) ) );
+            capacity = static_cast<std::size_t>( std::round( static_cast<double>( n ) * factor ) );
+        }
+
+        std::size_t segment_count = ( capacity + segment_length_ - 1 ) / segment_length_;
+        segment_count = segment_count <= 2? 1: segment_count - 2;
+
+        segment_count += extra_segments;
+
+        BOOST_ASSERT( ( segment_count + 2 ) * segment_length_ <= 0xFFFFFFFFu );
+
+        segment_count_length_ = static_cast<std::uint32_t>( segment_count * segment_length_ );
+
+        fp_.assign( segment_count_length_ + 2 * segment_length_, 0 );
+    }
+
+    // one construction attempt over the sorted, unique hash values in h;
+    // fails when the hypergraph can't be peeled completely
+
+    bool populate( std::vector<std::uint64_t> const& h )
+    {
+        std::size_t const n = h.size();
+        std::size_t const m = fp_.size();
+
+        // for each position, the number of keys mapped to it (times 4) plus the
+        // xor of their position indices (0, 1, 2) in the low two bits, and the
+        // xor of their hash values; a position with a count of one has a known
+        // key, and is peeled
+
+        std::vector<unsigned char> count( m );
+        std::vector<std::uint64_t> xh( m );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            std::uint32_t p[ 3 ];
+            positions( h[ i ], p );
+
+            for( int j = 0; j < 3; ++j )
+            {
+                if( count[ p[ j ] ] >= 252 ) return false;
+
+                count[ p[ j ] ] = static_cast<unsigned char>( ( count[ p[ j ] ] + 4 ) ^ j );
+                xh[ p[ j ] ] ^= h[ i ];
+            }
+        }
+
+        std::vector<std::uint32_t> alone;
+        alone.reserve( m );
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            if( ( count[ i ] >> 2 ) == 1 )
+            {
+                alone.push_back( static_cast<std::uint32_t>( i ) );
+            }
+        }
+
+        // the peeling order; the keys are assigned in reverse
+
+        std::vector<std::uint64_t> stack_h;
+        std::vector<unsigned char> stack_j;
+
+        stack_h.reserve( n );
+        stack_j.reserve( n );
+
+        while( !alone.empty() )
+        {
+            std::uint32_t i = alone.back();
+            alone.pop_back();
+
+            if( ( count[ i ] >> 2 ) != 1 ) continue;
+
+            std::uint64_t x = xh[ i ];
+            int j = count[ i ] & 3;
+
+            stack_h.push_back( x );
+            stack_j.push_back( static_cast<unsigned char>( j ) );
+
+            std::uint32_t p[ 3 ];
+            positions( x, p );
+
+            for( int k = 0; k < 3; ++k )
+            {
+                std::uint32_t q = p[ k ];
+
+                count[ q ] = static_cast<unsigned char>( ( count[ q ] - 4 ) ^ k );
+                xh[ q ] ^= x;
+
+                if( k != j && ( count[ q ] >> 2 ) == 1 )
+                {
+                    alone.push_back( q );
+                }
+            }
+        }
+
+        if( stack_h.size() != n ) return false;
+
+        for( std::size_t i = n; i > 0; --i )
+        {
+            std::uint64_t x = stack_h[ i - 1 ];
+            int j = stack_j[ i - 1 ];
+
+            std::uint32_t p[ 3 ];
+            positions( x, p );
+
+            fp_[ p[ j ] ] = 0;
+            fp_[ p[ j ] ] = static_cast<fingerprint_type>( fingerprint( x ) ^ fp_[ p[ 0 ] ] ^ fp_[ p[ 1 ] ] ^ fp_[ p[ 2 ] ] );
+        }
+
+        return true;
+    }
+
+public:
+
+    static constexpr int fingerprint_bits = FingerprintBits;
+
+    // an empty filter, which contains no values
+
+    binary_fuse_filter()
+    {
+        init( 0, 0 );
+    }
+
+    // builds a filter from the values in [first, last), which may contain
+    // duplicates; It must be a forward iterator, as a failed construction
+    // attempt is retried with a different seed
+
+    template<class It> binary_fuse_filter( It first, It last, std::uint64_t seed = 0 )
+    {
+        std::vector<std::uint64_t> h;
+
+        std::size_t extra = 0;
+
+        for( std::size_t attempt = 1;; ++attempt )
+        {
+            seed_ = seed;
+            base::reseed( seed_ );
+
+            h.clear();
+
+            for( It it = first; it != last; ++it )
+            {
+                h.push_back( base::hash_value( *it ) );
+            }
+
+            std::sort( h.begin(), h.end() );
+            h.erase( std::unique( h.begin(), h.end() ), h.end() );
+
+            init( h.size(), extra );
+
+            if( populate( h ) ) break;
+
+            // the failure probability of an attempt is small; a run of
+            // failures is only possible for very small n, and is cured
+            // by a larger array
+
+            detail::splitmix64( seed );
+
+            if( attempt % 8 == 0 )
+            {
+                extra += 1 + segment_count_length_ / segment_length_ / 8;
+            }
+        }
+    }
+
+    std::uint64_t seed() const noexcept
+    {
+        return seed_;
+    }
+
+    std::size_t fingerprint_count() const noexcept
+    {
+        return fp_.size();
+    }
+
+    bool contains( T const& v ) const
+    {
+        return contains_hash( base::hash_value( v ) );
+    }
+
+    template<class It, class Out> Out contains( It first, It last, Out out ) const
+    {
+        std::uint64_t h[ detail::fuse_batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < detail::fuse_batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = base::hash_value( *first );
+                prefetch_hash( h[ n ] );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                *out++ = contains_hash( h[ i ] );
+            }
+        }
+
+        return out;
+    }
+
+    // serialization
+    //
+    // 64 bit seed, 32 bit segment length, 32 bit segment count * segment
+    // length, then the fingerprints, all little-endian
+
+    std::size_t byte_size() const noexcept
+    {
+        return 16 + fp_.size() * sizeof( fingerprint_type );
+    }
+
+    void serialize( unsigned char* p ) const noexcept
+    {
+        detail::write64le( p, seed_ );
+        detail::write32le( p + 8, segment_length_ );
+        detail::write32le( p + 12, segment_count_length_ );
+
+        p += 16;
+
+        for( std::size_t i = 0; i < fp_.size(); ++i )
+        {
+            for( std::size_t k = 0; k < sizeof( fingerprint_type ); ++k )
+            {
+                *p++ = static_cast<unsigned char>( ( fp_[ i ] >> ( 8 * k ) ) & 0xFF );
+            }
+        }
+    }
+
+    // replaces the filter with the deserialized one; returns false,
+    // leaving *this unchanged, if [p, p+n) is malformed
+    bool deserialize( unsigned char const* p, std::size_t n )
+    {
+        if( n < 16 ) return false;
+
+        std::uint64_t seed = detail::read64le( p );
+        std::uint32_t sl = detail::read32le( p + 8 );
+        std::uint32_t scl = detail::read32le( p + 12 );
+
+        if( sl == 0 || ( sl & ( sl - 1 ) ) != 0 || scl == 0 || scl % sl != 0 ) return false;
+
+        std::uint64_t m = static_cast<std::uint64_t>( scl ) + 2 * static_cast<std::uint64_t>( sl );
+
+        if( m > 0xFFFFFFFFu || ( n - 16 ) / sizeof( fingerprint_type ) != m || ( n - 16 ) % sizeof( fingerprint_type ) != 0 ) return false;
+
+        std::vector<fingerprint_type> fp( static_cast<std::size_t>( m ) );
+
+        p += 16;
+
+        for( std::size_t i = 0; i < fp.size(); ++i )
+        {
+            std::uint32_t v = 0;
+
+            for( std::size_t k = 0; k < sizeof( fingerprint_type ); ++k )
+            {
+                v |= static_cast<std::uint32_t>( *p++ ) << ( 8 * k );
+            }
+
+            fp[ i ] = static_cast<fingerprint_type>( v );
+        }
+
+        seed_ = seed;
+        base::reseed( seed_ );
+
+        segment_length_ = sl;
+        segment_count_length_ = scl;
+
+        fp_.swap( fp );
+
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BINARY_FUSE_FILTER_HPP_INCLUDED
@@ -0,0 +1,555 @@
+#ifndef BOOST_HASH2_BLOOM_FILTER_HPP_INCLUDED
+#define BOOST_HASH2_BLOOM_FILTER_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Bloom filters
+//
+// Adam Kirsch, Michael Mitzenmacher, Less Hashing, Same Performance:
+// Building a Better Bloom Filter
+//
+// Felix Putze, Peter Sanders, Johannes Singler, Cache-, Hash- and
+// Space-Efficient Bloom Filters
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/sketch_hasher.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the number of keys whose hash values are computed, and
+// whose first cache lines are prefetched, before probing
+constexpr std::size_t bloom_batch_size = 16;
+
+template<class T, class Hash, class Flavor> class bloom_filter_base: protected sketch_hasher<T, Hash, Flavor>
+{
+protected:
+
+    bloom_filter_base() = default;
+
+    explicit bloom_filter_base( std::uint64_t seed ): sketch_hasher<T, Hash, Flavor>( seed )
+    {
+    }
+
+    bloom_filter_base( unsigned char const* p, std::size_t n ): sketch_hasher<T, Hash, Flavor>( p, n )
+    {
+    }
+
+    // second hash function for double hashing, derived from the first; odd,
+    // so that it's coprime with power of two block sizes
+    static std::uint64_t hash_step( std::uint64_t h1 )
+    {
+        return ( ( h1 >> 32 ) | ( h1 << 32 ) ) * 0x9E3779B97F4A7C15ull | 1;
+    }
+
+    static void write_words( std::uint64_t const* w, std::size_t n, unsigned char* p )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            detail::write64le( p + 8 * i, w[ i ] );
+        }
+    }
+
+    static void read_words( unsigned char const* p, std::size_t n, std::uint64_t* w )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            w[ i ] = detail::read64le( p + 8 * i );
+        }
+    }
+};
+
+} // namespace detail
+
+// bloom_filter
+
+template<class T, class Hash, class Flavor = default_flavor> class bloom_filter: private detail::bloom_filter_base<T, Hash, Flavor>
+{
+private:
+
+    using base = detail::bloom_filter_base<T, Hash, Flavor>;
+
+    std::vector<std::uint64_t> bits_;
+    std::size_t m_; // number of bits, a multiple of 64
+    int k_;
+
+private:
+
+    std::size_t index( std::uint64_t g ) const
+    {
+        return static_cast<std::size_t>( detail::mul128( g, m_ ).high );
+    }
+
+    void insert_hash( std::uint64_t h1 )
+    {
+        std::uint64_t const h2 = base::hash_step( h1 );
+
+        for( int i = 0; i < k_; ++i, h1 += h2 )
+        {
+            std::size_t j = index( h1 );
+            bits_[ j / 64 ] |= std::uint64_t( 1 ) << ( j % 64 );
+        }
+    }
+
+    bool contains_hash( std::uint64_t h1 ) const
+    {
+        std::uint64_t const h2 = base::hash_step( h1 );
+
+        for( int i = 0; i < k_; ++i, h1 += h2 )
+        {
+            std::size_t j = index( h1 );
+
+            if( ( bits_[ j / 64 ] & ( std::uint64_t( 1 ) << ( j % 64 ) ) ) == 0 )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void prefetch_hash( std::uint64_t h1 ) const
+    {
+        detail::prefetch( bits_.data() + index( h1 ) / 64 );
+    }
+
+    void init( std::size_t m, int k )
+    {
+        BOOST_ASSERT( k > 0 );
+
+        m_ = ( m + 63 ) / 64 * 64;
+
+        if( m_ == 0 )
+        {
+            m_ = 64;
+        }
+
+        k_ = k;
+
+        bits_.resize( m_ / 64 );
+    }
+
+public:
+
+    bloom_filter( std::size_t m, int k )
+    {
+        init( m, k );
+    }
+
+    bloom_filter( std::size_t m, int k, std::uint64_t seed ): base( seed )
+    {
+        init( m, k );
+    }
+
+    bloom_filter( std::size_t m, int k, unsigned char const* p, std::size_t n ): base( p, n )
+    {
+        init( m, k );
+    }
+
+    bloom_filter( std::size_t m, int k, void const* p, std::size_t n ): bloom_filter( m, k, static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    std::size_t bit_count() const noexcept
+    {
+        return m_;
+    }
+
+    int hash_count() const noexcept
+    {
+        return k_;
+    }
+
+    void clear() noexcept
+    {
+        for( std::size_t i = 0; i < bits_.size(); ++i )
+        {
+            bits_[ i ] = 0;
+        }
+    }
+
+    void insert( T const& v )
+    {
+        insert_hash( base::hash_value( v ) );
+    }
+
+    bool contains( T const& v ) const
+    {
+        return contains_hash( base::hash_value( v ) );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        std::uint64_t h[ detail::bloom_batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < detail::bloom_batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = base::hash_value( *first );
+                prefetch_hash( h[ n ] );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                insert_hash( h[ i ] );
+            }
+        }
+    }
+
+    template<class It, class Out> Out contains( It first, It last, Out out ) const
+    {
+        std::uint64_t h[ detail::bloom_batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < detail::bloom_batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = base::hash_value( *first );
+                prefetch_hash( h[ n ] );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                *out++ = contains_hash( h[ i ] );
+            }
+        }
+
+        return out;
+    }
+
+    // union; both filters must have the same parameters and seed
+    bloom_filter& operator|=( bloom_filter const& rhs )
+    {
+        BOOST_ASSERT( m_ == rhs.m_ && k_ == rhs.k_ );
+
+        for( std::size_t i = 0; i < bits_.size(); ++i )
+        {
+            bits_[ i ] |= rhs.bits_[ i ];
+        }
+
+        return *this;
+    }
+
+    // serialization
+    //
+    // the header of sketch_hasher, with the number of hash functions and
+    // the number of bits, then the bit array, as little-endian 64 bit words
+
+    std::size_t byte_size() const noexcept
+    {
+        return base::header_size + m_ / 8;
+    }
+
+    void serialize( unsigned char* p ) const
+    {
+        base::write_header( p, detail::sketch_format_bloom, static_cast<std::uint32_t>( k_ ), m_ );
+        base::write_words( bits_.data(), bits_.size(), p + base::header_size );
+    }
+
+    // replaces the bit array with the serialized one; returns false,
+    // leaving *this unchanged, if [p, p+n) is malformed or has been
+    // produced by a filter with different parameters or seed
+    bool deserialize( unsigned char const* p, std::size_t n )
+    {
+        if( n != byte_size() || !base::check_header( p, detail::sketch_format_bloom, static_cast<std::uint32_t>( k_ ), m_ ) ) return false;
+
+        base::read_words( p + base::header_size, bits_.size(), bits_.data() );
+        return true;
+    }
+};
+
+// blocked_bloom_filter
+
+template<class T, class Hash, class Flavor = default_flavor> class blocked_bloom_filter: private detail::bloom_filter_base<T, Hash, Flavor>
+{
+private:
+
+    using base = detail::bloom_filter_base<T, Hash, Flavor>;
+
+    static constexpr std::size_t block_words = 8; // 64 bytes, 512 bits
+
+    // one spare block, so that the blocks can be aligned on a cache line
+    std::vector<std::uint64_t> storage_;
+    std::size_t blocks_;
+    int k_;
+
+private:
+
+    std::uint64_t* data() noexcept
+    {
+        std::uintptr_t p = reinterpret_cast<std::uintptr_t>( storage_.data() );
+        return storage_.data() + ( ( 64 - p % 64 ) % 64 ) / 8;
+    }
+
+    std::uint64_t const* data() const noexcept
+    {
+        std::uintptr_t p = reinterpret_cast<std::uintptr_t>( storage_.data() );
+        return storage_.data() + ( ( 64 - p % 64 ) % 64 ) / 8;
+    }
+
+    std::uint64_t const* block( std::uint64_t h1 ) const noexcept
+    {
+        return data() + detail::mul128( h1, blocks_ ).high * block_words;
+    }
+
+    std::uint64_t* block( std::uint64_t h1 ) noexcept
+    {
+        return data() + detail::mul128( h1, blocks_ ).high * block_words;
+    }
+
+    // the block is selected by the high bits of h1, the bits within it by
+    // double hashing on the low bits; the resulting mask is tested word-wise,
+    // in a form that compilers turn into vector instructions
+
+    void make_mask( std::uint64_t h1, std::uint64_t (&mask)[ block_words ] ) const noexcept
+    {
+        for( std::size_t i = 0; i < block_words; ++i )
+        {
+            mask[ i ] = 0;
+        }
+
+        std::uint64_t const h2 = base::hash_step( h1 );
+
+        for( int i = 0; i < k_; ++i, h1 += h2 )
+        {
+            unsigned j = static_cast<unsigned>( h1 ) & 511;
+            mask[ j / 64 ] |= std::uint64_t( 1 ) << ( j % 64 );
+        }
+    }
+
+    void insert_hash( std::uint64_t h1 ) noexcept
+    {
+        std::uint64_t mask[ block_words ];
+        make_mask( h1, mask );
+
+        std::uint64_t* p = block( h1 );
+
+        for( std::size_t i = 0; i < block_words; ++i )
+        {
+            p[ i ] |= mask[ i ];
+        }
+    }
+
+    bool contains_hash( std::uint64_t h1 ) const noexcept
+    {
+        std::uint64_t mask[ block_words ];
+        make_mask( h1, mask );
+
+        std::uint64_t const* p = block( h1 );
+
+        std::uint64_t r = 0;
+
+        for( std::size_t i = 0; i < block_words; ++i )
+        {
+            r |= mask[ i ] & ~p[ i ];
+        }
+
+        return r == 0;
+    }
+
+    void init( std::size_t m, int k )
+    {
+        BOOST_ASSERT( k > 0 );
+
+        blocks_ = ( m + 511 ) / 512;
+
+        if( blocks_ == 0 )
+        {
+            blocks_ = 1;
+        }
+
+        k_ = k;
+
+        storage_.resize( ( blocks_ + 1 ) * block_words );
+    }
+
+public:
+
+    blocked_bloom_filter( std::size_t m, int k )
+    {
+        init( m, k );
+    }
+
+    blocked_bloom_filter( std::size_t m, int k, std::uint64_t seed ): base( seed )
+    {
+        init( m, k );
+    }
+
+    blocked_bloom_filter( std::size_t m, int k, unsigned char const* p, std::size_t n ): base( p, n )
+    {
+        init( m, k );
+    }
+
+    blocked_bloom_filter( std::size_t m, int k, void const* p, std::size_t n ): blocked_bloom_filter( m, k, static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    // the alignment offset into storage_ isn't preserved by copying it
+
+    blocked_bloom_filter( blocked_bloom_filter const& rhs ): base( rhs ), storage_( rhs.storage_.size() ), blocks_( rhs.blocks_ ), k_( rhs.k_ )
+    {
+        std::memcpy( data(), rhs.data(), blocks_ * 64 );
+    }
+
+    blocked_bloom_filter( blocked_bloom_filter&& rhs ) = default;
+
+    blocked_bloom_filter& operator=( blocked_bloom_filter const& rhs )
+    {
+        if( this != &rhs )
+        {
+            base::operator=( rhs );
+
+            storage_.assign( rhs.storage_.size(), 0 );
+            blocks_ = rhs.blocks_;
+            k_ = rhs.k_;
+
+            std::memcpy( data(), rhs.data(), blocks_ * 64 );
+        }
+
+        return *this;
+    }
+
+    blocked_bloom_filter& operator=( blocked_bloom_filter&& rhs ) = default;
+
+    std::size_t bit_count() const noexcept
+    {
+        return blocks_ * 512;
+    }
+
+    int hash_count() const noexcept
+    {
+        return k_;
+    }
+
+    void clear() noexcept
+    {
+        for( std::size_t i = 0; i < storage_.size(); ++i )
+        {
+            storage_[ i ] = 0;
+        }
+    }
+
+    void insert( T const& v )
+    {
+        insert_hash( base::hash_value( v ) );
+    }
+
+    bool contains( T const& v ) const
+    {
+        return contains_hash( base::hash_value( v ) );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        std::uint64_t h[ detail::bloom_batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < detail::bloom_batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = base::hash_value( *first );
+                detail::prefetch( block( h[ n ] ) );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                insert_hash( h[ i ] );
+            }
+        }
+    }
+
+    template<class It, class Out> Out contains( It first, It last, Out out ) const
+    {
+        std::uint64_t h[ detail::bloom_batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < detail::bloom_batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = base::hash_value( *first );
+                detail::prefetch( block( h[ n ] ) );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                *out++ = contains_hash( h[ i ] );
+            }
+        }
+
+        return out;
+    }
+
+    // union; both filters must have the same parameters and seed
+    blocked_bloom_filter& operator|=( blocked_bloom_filter const& rhs )
+    {
+        BOOST_ASSERT( blocks_ == rhs.blocks_ && k_ == rhs.k_ );
+
+        std::uint64_t* p = data();
+        std::uint64_t const* q = rhs.data();
+
+        for( std::size_t i = 0; i < blocks_ * block_words; ++i )
+        {
+            p[ i ] |= q[ i ];
+        }
+
+        return *this;
+    }
+
+    // serialization
+    //
+    // the header of sketch_hasher, with the number of hash functions and
+    // the number of blocks, then the blocks, as little-endian 64 bit words
+
+    std::size_t byte_size() const noexcept
+    {
+        return base::header_size + blocks_ * 64;
+    }
+
+    void serialize( unsigned char* p ) const
+    {
+        base::write_header( p, detail::sketch_format_blocked_bloom, static_cast<std::uint32_t>( k_ ), blocks_ );
+        base::write_words( data(), blocks_ * block_words, p + base::header_size );
+    }
+
+    // replaces the blocks with the serialized ones; returns false,
+    // leaving *this unchanged, if [p, p+n) is malformed or has been
+    // produced by a filter with different parameters or seed
+    bool deserialize( unsigned char const* p, std::size_t n )
+    {
+        if( n != byte_size() || !base::check_header( p, detail::sketch_format_blocked_bloom, static_cast<std::uint32_t>( k_ ), blocks_ ) ) return false;
+
+        base::read_words( p + base::header_size, blocks_ * block_words, data() );
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLOOM_FILTER_HPP_INCLUDED
@@ -0,0 +1,142 @@
+#ifndef BOOST_HASH2_BUFFERED_HASHER_HPP_INCLUDED
+#define BOOST_HASH2_BUFFERED_HASHER_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// a hash algorithm adaptor that coalesces small updates, such as those
+// produced by hash_append for the members of a composite type, and
+// passes them to the underlying algorithm in blocks of N bytes
+
+template<class H, std::size_t N = 256> class buffered_hasher
+{
+private:
+
+    static_assert( N >= 8, "The buffer size must be at least 8" );
+
+    H h_;
+
+    unsigned char buffer_[ N ] = {};
+    std::size_t m_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void flush()
+    {
+        if( m_ > 0 )
+        {
+            h_.update( buffer_, m_ );
+            m_ = 0;
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update_( unsigned char const* p, std::size_t n )
+    {
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            h_.update( buffer_, N );
+            m_ = 0;
+
+            p += k;
+            n -= k;
+        }
+
+        if( n >= N )
+        {
+            h_.update( p, n );
+        }
+        else
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+public:
+
+    using result_type = typename H::result_type;
+
+    buffered_hasher() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit buffered_hasher( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR buffered_hasher( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    buffered_hasher( void const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit buffered_hasher( H const& h ): h_( h )
+    {
+    }
+
+    // the common case, when the input fits in the buffer, is inlined
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        if( n <= N - m_ )
+        {
+            detail::memcpy( buffer_ + m_, p, n );
+            m_ += n;
+        }
+        else
+        {
+            update_( p, n );
+        }
+    }
+
+    BOOST_FORCEINLINE void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // equivalent to update() with the bytes of w in little endian order
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_u32( std::uint32_t w )
+    {
+        if( N - m_ < 4 ) flush();
+
+        detail::write32le( buffer_ + m_, w );
+        m_ += 4;
+    }
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_u64( std::uint64_t w )
+    {
+        if( N - m_ < 8 ) flush();
+
+        detail::write64le( buffer_ + m_, w );
+        m_ += 8;
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        flush();
+        return h_.result();
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BUFFERED_HASHER_HPP_INCLUDED
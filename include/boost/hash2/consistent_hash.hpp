@@ -0,0 +1,328 @@
+#ifndef BOOST_HASH2_CONSISTENT_HASH_HPP_INCLUDED
+#define BOOST_HASH2_CONSISTENT_HASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Consistent hashing
+//
+// John Lamping, Eric Veach, A Fast, Minimal Memory, Consistent Hash Algorithm
+//
+// David G. Thaler, Chinya V. Ravishankar, Using Name-Based Mappings
+// to Increase Hit Rates (rendezvous, or highest random weight, hashing)
+//
+// Jason Resch, New Hashing Algorithms for Data Storage (weighted
+// rendezvous hashing with logarithmic scores)
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// jump consistent hash; maps key to a bucket in [0, buckets), such
+// that going from n to n + 1 buckets moves 1 / (n + 1) of the keys,
+// all of them to the new bucket
+
+inline BOOST_CXX14_CONSTEXPR std::int32_t jump_consistent_hash( std::uint64_t key, std::int32_t buckets ) noexcept
+{
+    BOOST_ASSERT( buckets > 0 );
+
+    std::int64_t b = -1, j = 0;
+
+    while( j < buckets )
+    {
+        b = j;
+        key = key * 2862933555777941757ull + 1;
+        j = static_cast<std::int64_t>( static_cast<double>( b + 1 ) * ( static_cast<double>( 1ll << 31 ) / static_cast<double>( ( key >> 33 ) + 1 ) ) );
+    }
+
+    return static_cast<std::int32_t>( b );
+}
+
+namespace detail
+{
+
+// the number of node scores computed, into a local array, before
+// they are merged into the current top r
+constexpr std::size_t rendezvous_chunk_size = 64;
+
+// the top r is kept on the stack up to this r
+constexpr std::size_t rendezvous_small_r = 16;
+
+} // namespace detail
+
+// weighted rendezvous hashing over a set of nodes; the node selected
+// for a key is the one with the highest score for the (key, node) pair
+
+template<class Node, class Hash, class Flavor = default_flavor> class rendezvous_hash
+{
+private:
+
+    Hash h_;
+
+    std::vector<Node> nodes_;
+
+    // the hash value and the weight of each node
+    std::vector<std::uint64_t> nh_;
+    std::vector<double> w_;
+
+    // true when all weights are equal, and the scores don't need logarithms
+    bool uniform_ = true;
+
+private:
+
+    template<class T> std::uint64_t hash_value( T const& v ) const
+    {
+        Hash h( h_ );
+        hash2::hash_append( h, Flavor(), v );
+
+        return hash2::get_integral_result<std::uint64_t>( h );
+    }
+
+    void update_uniform() noexcept
+    {
+        uniform_ = true;
+
+        for( std::size_t i = 1; i < w_.size(); ++i )
+        {
+            if( w_[ i ] != w_[ 0 ] )
+            {
+                uniform_ = false;
+                break;
+            }
+        }
+    }
+
+    // the score of a (key, node) pair is derived from x = mix( key hash ^ node hash );
+    // with u = x / 2^64 in (0, 1), it's w / -log(u), which selects a node with
+    // probability proportional to its weight, and just u for equal weights,
+    // which ranks the nodes identically
+
+    static double unit( std::uint64_t x ) noexcept
+    {
+        return ( static_cast<double>( x >> 11 ) + 0.5 ) * ( 1.0 / 9007199254740992.0 );
+    }
+
+    double score( std::uint64_t kh, std::size_t i ) const noexcept
+    {
+        return w_[ i ] / -std::log( unit( detail::splitmix64_mix( kh ^ nh_[ i ] ) ) );
+    }
+
+    // computes the exact scores for equal weights, and upper bounds of the
+    // scores, w / (1 - u), for which no logarithms are needed, otherwise;
+    // both loops have no dependencies between nodes, and compilers
+    // vectorize them
+
+    void bounds( std::uint64_t kh, std::size_t first, std::size_t n, double* s ) const noexcept
+    {
+        std::uint64_t const* nh = nh_.data() + first;
+
+        if( uniform_ )
+        {
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                s[ i ] = static_cast<double>( detail::splitmix64_mix( kh ^ nh[ i ] ) >> 11 );
+            }
+        }
+        else
+        {
+            double const* w = w_.data() + first;
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                s[ i ] = w[ i ] / ( 1.0 - unit( detail::splitmix64_mix( kh ^ nh[ i ] ) ) );
+            }
+        }
+    }
+
+    // computes the r highest scoring nodes for kh into ti, in decreasing
+    // order of score; ts holds their scores. With unequal weights, only
+    // the nodes whose bound exceeds the current r-th score are scored
+    // exactly, about r * log(n / r) of them
+
+    void top( std::uint64_t kh, std::size_t r, double* ts, std::size_t* ti ) const noexcept
+    {
+        std::size_t const n = nodes_.size();
+        std::size_t m = 0;
+
+        double s[ detail::rendezvous_chunk_size ];
+
+        for( std::size_t first = 0; first < n; first += detail::rendezvous_chunk_size )
+        {
+            std::size_t k = n - first < detail::rendezvous_chunk_size? n - first: detail::rendezvous_chunk_size;
+
+            bounds( kh, first, k, s );
+
+            for( std::size_t i = 0; i < k; ++i )
+            {
+                if( m == r && !( s[ i ] > ts[ m - 1 ] ) ) continue;
+
+                double si = s[ i ];
+
+                if( !uniform_ )
+                {
+                    si = score( kh, first + i );
+                    if( m == r && !( si > ts[ m - 1 ] ) ) continue;
+                }
+
+                std::size_t j = m < r? m++: m - 1;
+
+                for( ; j > 0 && ts[ j - 1 ] < si; --j )
+                {
+                    ts[ j ] = ts[ j - 1 ];
+                    ti[ j ] = ti[ j - 1 ];
+                }
+
+                ts[ j ] = si;
+                ti[ j ] = first + i;
+            }
+        }
+    }
+
+public:
+
+    rendezvous_hash() = default;
+
+    explicit rendezvous_hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    rendezvous_hash( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    rendezvous_hash( void const* p, std::size_t n ): rendezvous_hash( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    std::size_t size() const noexcept
+    {
+        return nodes_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return nodes_.empty();
+    }
+
+    Node const& node( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < nodes_.size() );
+        return nodes_[ i ];
+    }
+
+    double weight( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < w_.size() );
+        return w_[ i ];
+    }
+
+    // adding a node moves to it only the keys for which it scores highest
+
+    void insert( Node const& node, double weight = 1.0 )
+    {
+        BOOST_ASSERT( weight > 0 );
+
+        nodes_.push_back( node );
+        nh_.push_back( hash_value( node ) );
+        w_.push_back( weight );
+
+        update_uniform();
+    }
+
+    // removing a node moves only the keys that were assigned to it
+
+    bool erase( Node const& node )
+    {
+        for( std::size_t i = 0; i < nodes_.size(); ++i )
+        {
+            if( nodes_[ i ] == node )
+            {
+                nodes_.erase( nodes_.begin() + i );
+                nh_.erase( nh_.begin() + i );
+                w_.erase( w_.begin() + i );
+
+                update_uniform();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void clear() noexcept
+    {
+        nodes_.clear();
+        nh_.clear();
+        w_.clear();
+
+        uniform_ = true;
+    }
+
+    // the index of the node selected for k
+
+    template<class Key> std::size_t select_index( Key const& k ) const
+    {
+        BOOST_ASSERT( !empty() );
+
+        double ts[ 1 ];
+        std::size_t ti[ 1 ];
+
+        top( hash_value( k ), 1, ts, ti );
+        return ti[ 0 ];
+    }
+
+    template<class Key> Node const& select( Key const& k ) const
+    {
+        return nodes_[ select_index( k ) ];
+    }
+
+    // the indices of the min(r, size()) nodes selected for k, as replicas,
+    // in decreasing order of preference; select_index( k ) is the first
+
+    template<class Key, class Out> Out select_n( Key const& k, std::size_t r, Out out ) const
+    {
+        if( r > nodes_.size() ) r = nodes_.size();
+        if( r == 0 ) return out;
+
+        std::uint64_t kh = hash_value( k );
+
+        if( r <= detail::rendezvous_small_r )
+        {
+            double ts[ detail::rendezvous_small_r ];
+            std::size_t ti[ detail::rendezvous_small_r ];
+
+            top( kh, r, ts, ti );
+
+            for( std::size_t i = 0; i < r; ++i ) *out++ = ti[ i ];
+        }
+        else
+        {
+            std::vector<double> ts( r );
+            std::vector<std::size_t> ti( r );
+
+            top( kh, r, ts.data(), ti.data() );
+
+            for( std::size_t i = 0; i < r; ++i ) *out++ = ti[ i ];
+        }
+
+        return out;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CONSISTENT_HASH_HPP_INCLUDED
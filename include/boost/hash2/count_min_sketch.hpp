@@ -0,0 +1,653 @@
+#ifndef BOOST_HASH2_COUNT_MIN_SKETCH_HPP_INCLUDED
+#define BOOST_HASH2_COUNT_MIN_SKETCH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Count-Min and Count sketches
+//
+// Graham Cormode, S. Muthukrishnan, An Improved Data Stream Summary:
+// The Count-Min Sketch and its Applications
+//
+// Cristian Estan, George Varghese, New Directions in Traffic Measurement
+// and Accounting (conservative update)
+//
+// Moses Charikar, Kevin Chen, Martin Farach-Colton, Finding Frequent
+// Items in Data Streams (Count sketch)
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/sketch_hasher.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the number of keys whose hash values are computed, and
+// whose counters are prefetched, before updating them
+constexpr std::size_t frequency_batch_size = 16;
+
+// the common part of the frequency sketches: a d x w matrix of
+// counters, w a power of two, and the mapping from a 64 bit hash
+// value to one counter per row (and, if Signed, a sign)
+//
+// the counters are atomic, so that the ordinary updates, which use
+// relaxed loads and stores, can be performed concurrently without
+// data races; concurrent increments of the same counter may be lost,
+// which the atomic updates, using read-modify-write operations, avoid
+
+template<class T, class Hash, class Counter, class Flavor, bool Signed> class frequency_sketch_base: protected sketch_hasher<T, Hash, Flavor>
+{
+private:
+
+    static_assert( std::is_integral<Counter>::value && std::is_signed<Counter>::value == Signed, "Counter must be a signed integral type for count_sketch and an unsigned one otherwise" );
+
+    using base = sketch_hasher<T, Hash, Flavor>;
+
+    std::vector< std::atomic<Counter> > c_;
+    int b_; // log2 of the width
+    int d_;
+
+private:
+
+    void init( std::size_t w, int d )
+    {
+        BOOST_ASSERT( w > 0 && w <= ( std::size_t( 1 ) << 31 ) );
+        BOOST_ASSERT( d > 0 && d <= max_depth );
+
+        b_ = 0;
+
+        while( ( std::size_t( 1 ) << b_ ) < w )
+        {
+            ++b_;
+        }
+
+        d_ = d;
+
+        std::vector< std::atomic<Counter> >( static_cast<std::size_t>( d ) << b_ ).swap( c_ );
+    }
+
+    void copy( frequency_sketch_base const& rhs ) noexcept
+    {
+        for( std::size_t i = 0; i < c_.size(); ++i )
+        {
+            c_[ i ].store( rhs.c_[ i ].load( std::memory_order_relaxed ), std::memory_order_relaxed );
+        }
+    }
+
+protected:
+
+    static constexpr int max_depth = 32;
+
+    static constexpr std::uint32_t format = Signed? sketch_format_count: sketch_format_count_min;
+
+    frequency_sketch_base( std::size_t w, int d )
+    {
+        init( w, d );
+    }
+
+    frequency_sketch_base( std::size_t w, int d, std::uint64_t seed ): base( seed )
+    {
+        init( w, d );
+    }
+
+    frequency_sketch_base( std::size_t w, int d, unsigned char const* p, std::size_t n ): base( p, n )
+    {
+        init( w, d );
+    }
+
+    frequency_sketch_base( frequency_sketch_base const& rhs ): base( rhs ), c_( rhs.c_.size() ), b_( rhs.b_ ), d_( rhs.d_ )
+    {
+        copy( rhs );
+    }
+
+    frequency_sketch_base( frequency_sketch_base&& rhs ) = default;
+
+    frequency_sketch_base& operator=( frequency_sketch_base const& rhs )
+    {
+        if( this != &rhs )
+        {
+            base::operator=( rhs );
+
+            std::vector< std::atomic<Counter> >( rhs.c_.size() ).swap( c_ );
+            b_ = rhs.b_;
+            d_ = rhs.d_;
+
+            copy( rhs );
+        }
+
+        return *this;
+    }
+
+    frequency_sketch_base& operator=( frequency_sketch_base&& rhs ) = default;
+
+    // the row indices (and signs) are consecutive bit fields of the hash
+    // value; when these are exhausted, the value is extended with further
+    // 64 bit words, obtained by mixing it with a row counter
+    //
+    // f( j, s ) is called for each row, with j the counter position in
+    // c_ and s either 1 or -1
+
+    template<class F> void for_each_row( std::uint64_t x, F f ) const
+    {
+        int const s = b_ + Signed;
+        std::size_t const mask = ( std::size_t( 1 ) << b_ ) - 1;
+
+        std::uint64_t r = x;
+        int avail = 64;
+        std::uint64_t k = 0;
+
+        for( int i = 0; i < d_; ++i )
+        {
+            if( avail < s )
+            {
+                r = detail::splitmix64_mix( x + ++k * 0x9E3779B97F4A7C15ull );
+                avail = 64;
+            }
+
+            std::size_t j = ( static_cast<std::size_t>( i ) << b_ ) + ( static_cast<std::size_t>( r ) & mask );
+            int sign = Signed? 1 - 2 * static_cast<int>( ( r >> b_ ) & 1 ): 1;
+
+            f( j, sign );
+
+            r >>= s;
+            avail -= s;
+        }
+    }
+
+    void prefetch_hash( std::uint64_t x ) const
+    {
+        for_each_row( x, [this]( std::size_t j, int ){ detail::prefetch( c_.data() + j ); } );
+    }
+
+    // computes the hash values of up to frequency_batch_size values and
+    // prefetches their counters, then calls f with each hash value
+
+    template<class It, class F> void for_each_batch( It first, It last, F f ) const
+    {
+        std::uint64_t h[ frequency_batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < frequency_batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = base::hash_value( *first );
+                prefetch_hash( h[ n ] );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                f( h[ i ] );
+            }
+        }
+    }
+
+    Counter load( std::size_t j ) const noexcept
+    {
+        return c_[ j ].load( std::memory_order_relaxed );
+    }
+
+    void store( std::size_t j, Counter v ) noexcept
+    {
+        c_[ j ].store( v, std::memory_order_relaxed );
+    }
+
+    void fetch_add( std::size_t j, Counter v ) noexcept
+    {
+        if( Signed )
+        {
+            // atomic signed arithmetic wraps around
+            c_[ j ].fetch_add( v, std::memory_order_relaxed );
+        }
+        else
+        {
+            Counter c = c_[ j ].load( std::memory_order_relaxed );
+
+            while( !c_[ j ].compare_exchange_weak( c, add_counter( c, v ), std::memory_order_relaxed ) )
+            {
+            }
+        }
+    }
+
+    void fetch_max( std::size_t j, Counter v ) noexcept
+    {
+        Counter c = c_[ j ].load( std::memory_order_relaxed );
+
+        while( c < v && !c_[ j ].compare_exchange_weak( c, v, std::memory_order_relaxed ) )
+        {
+        }
+    }
+
+    // unsigned counters saturate at their maximum value; signed ones, whose
+    // updates cancel out, wrap around, using unsigned arithmetic to avoid
+    // overflow
+    static Counter add_counter( Counter a, Counter b ) noexcept
+    {
+        using U = typename std::make_unsigned<Counter>::type;
+        Counter r = static_cast<Counter>( static_cast<U>( static_cast<U>( a ) + static_cast<U>( b ) ) );
+
+        if( !Signed && r < a )
+        {
+            r = ( std::numeric_limits<Counter>::max )();
+        }
+
+        return r;
+    }
+
+    // -v in unsigned arithmetic; the minimum value of a signed type negates
+    // to itself instead of overflowing
+    static Counter negate( Counter v ) noexcept
+    {
+        using U = typename std::make_unsigned<Counter>::type;
+        return static_cast<Counter>( static_cast<U>( U( 0 ) - static_cast<U>( v ) ) );
+    }
+
+public:
+
+    std::size_t width() const noexcept
+    {
+        return std::size_t( 1 ) << b_;
+    }
+
+    int depth() const noexcept
+    {
+        return d_;
+    }
+
+    void clear() noexcept
+    {
+        for( std::size_t i = 0; i < c_.size(); ++i )
+        {
+            store( i, 0 );
+        }
+    }
+
+    // adds the counters of rhs; both sketches must have the same dimensions and seed
+    void merge( frequency_sketch_base const& rhs ) noexcept
+    {
+        BOOST_ASSERT( b_ == rhs.b_ && d_ == rhs.d_ );
+
+        for( std::size_t i = 0; i < c_.size(); ++i )
+        {
+            store( i, add_counter( load( i ), rhs.load( i ) ) );
+        }
+    }
+
+    // serialization
+    //
+    // the header of sketch_hasher, with the depth and the width, then the
+    // counters, row by row, as little-endian integers; the format tells
+    // signed counters from unsigned ones, and the size their width
+
+    std::size_t byte_size() const noexcept
+    {
+        return base::header_size + c_.size() * sizeof( Counter );
+    }
+
+    void serialize( unsigned char* p ) const
+    {
+        base::write_header( p, format, static_cast<std::uint32_t>( d_ ), width() );
+
+        p += base::header_size;
+
+        using U = typename std::make_unsigned<Counter>::type;
+
+        for( std::size_t i = 0; i < c_.size(); ++i )
+        {
+            U v = static_cast<U>( load( i ) );
+
+            for( std::size_t k = 0; k < sizeof( Counter ); ++k )
+            {
+                *p++ = static_cast<unsigned char>( ( v >> ( 8 * k ) ) & 0xFF );
+            }
+        }
+    }
+
+    // replaces the counters with the serialized ones; returns false,
+    // leaving *this unchanged, if [p, p+n) is malformed or has been
+    // produced by a sketch with different dimensions, Counter or seed
+    bool deserialize( unsigned char const* p, std::size_t n )
+    {
+        if( n != byte_size() || !base::check_header( p, format, static_cast<std::uint32_t>( d_ ), width() ) ) return false;
+
+        p += base::header_size;
+
+        using U = typename std::make_unsigned<Counter>::type;
+
+        for( std::size_t i = 0; i < c_.size(); ++i )
+        {
+            U v = 0;
+
+            for( std::size_t k = 0; k < sizeof( Counter ); ++k )
+            {
+                v |= static_cast<U>( static_cast<U>( *p++ ) << ( 8 * k ) );
+            }
+
+            store( i, static_cast<Counter>( v ) );
+        }
+
+        return true;
+    }
+};
+
+} // namespace detail
+
+// count_min_sketch
+
+template<class T, class Hash, class Counter = std::uint32_t, class Flavor = default_flavor> class count_min_sketch: private detail::frequency_sketch_base<T, Hash, Counter, Flavor, false>
+{
+private:
+
+    using base = detail::frequency_sketch_base<T, Hash, Counter, Flavor, false>;
+
+    void add_hash( std::uint64_t x, Counter count ) noexcept
+    {
+        base::for_each_row( x, [&]( std::size_t j, int ){ base::store( j, base::add_counter( base::load( j ), count ) ); } );
+    }
+
+    void add_atomic_hash( std::uint64_t x, Counter count ) noexcept
+    {
+        base::for_each_row( x, [&]( std::size_t j, int ){ base::fetch_add( j, count ); } );
+    }
+
+    Counter estimate_hash( std::uint64_t x ) const noexcept
+    {
+        Counter r = ( std::numeric_limits<Counter>::max )();
+        base::for_each_row( x, [&]( std::size_t j, int ){ r = ( std::min )( r, base::load( j ) ); } );
+
+        return r;
+    }
+
+public:
+
+    count_min_sketch( std::size_t w, int d ): base( w, d )
+    {
+    }
+
+    count_min_sketch( std::size_t w, int d, std::uint64_t seed ): base( w, d, seed )
+    {
+    }
+
+    count_min_sketch( std::size_t w, int d, unsigned char const* p, std::size_t n ): base( w, d, p, n )
+    {
+    }
+
+    count_min_sketch( std::size_t w, int d, void const* p, std::size_t n ): count_min_sketch( w, d, static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    using base::width;
+    using base::depth;
+    using base::clear;
+    using base::byte_size;
+    using base::serialize;
+    using base::deserialize;
+
+    void insert( T const& v )
+    {
+        add_hash( base::hash_value( v ), 1 );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        base::for_each_batch( first, last, [this]( std::uint64_t x ){ add_hash( x, 1 ); } );
+    }
+
+    void add( T const& v, Counter count )
+    {
+        add_hash( base::hash_value( v ), count );
+    }
+
+    void add_atomic( T const& v, Counter count )
+    {
+        add_atomic_hash( base::hash_value( v ), count );
+    }
+
+    template<class It> void insert_atomic( It first, It last )
+    {
+        base::for_each_batch( first, last, [this]( std::uint64_t x ){ add_atomic_hash( x, 1 ); } );
+    }
+
+    Counter estimate( T const& v ) const
+    {
+        return estimate_hash( base::hash_value( v ) );
+    }
+
+    template<class It, class Out> Out estimate( It first, It last, Out out ) const
+    {
+        base::for_each_batch( first, last, [&]( std::uint64_t x ){ *out++ = estimate_hash( x ); } );
+        return out;
+    }
+
+    void merge( count_min_sketch const& rhs ) noexcept
+    {
+        base::merge( rhs );
+    }
+};
+
+// conservative_count_min_sketch
+
+template<class T, class Hash, class Counter = std::uint32_t, class Flavor = default_flavor> class conservative_count_min_sketch: private detail::frequency_sketch_base<T, Hash, Counter, Flavor, false>
+{
+private:
+
+    using base = detail::frequency_sketch_base<T, Hash, Counter, Flavor, false>;
+
+    // only the counters below the new estimate are raised to it
+
+    void add_hash( std::uint64_t x, Counter count ) noexcept
+    {
+        Counter const e = base::add_counter( estimate_hash( x ), count );
+
+        base::for_each_row( x, [&]( std::size_t j, int ){ if( base::load( j ) < e ) base::store( j, e ); } );
+    }
+
+    void add_atomic_hash( std::uint64_t x, Counter count ) noexcept
+    {
+        Counter const e = base::add_counter( estimate_hash( x ), count );
+
+        base::for_each_row( x, [&]( std::size_t j, int ){ base::fetch_max( j, e ); } );
+    }
+
+    Counter estimate_hash( std::uint64_t x ) const noexcept
+    {
+        Counter r = ( std::numeric_limits<Counter>::max )();
+        base::for_each_row( x, [&]( std::size_t j, int ){ r = ( std::min )( r, base::load( j ) ); } );
+
+        return r;
+    }
+
+public:
+
+    conservative_count_min_sketch( std::size_t w, int d ): base( w, d )
+    {
+    }
+
+    conservative_count_min_sketch( std::size_t w, int d, std::uint64_t seed ): base( w, d, seed )
+    {
+    }
+
+    conservative_count_min_sketch( std::size_t w, int d, unsigned char const* p, std::size_t n ): base( w, d, p, n )
+    {
+    }
+
+    conservative_count_min_sketch( std::size_t w, int d, void const* p, std::size_t n ): conservative_count_min_sketch( w, d, static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    using base::width;
+    using base::depth;
+    using base::clear;
+    using base::byte_size;
+    using base::serialize;
+    using base::deserialize;
+
+    void insert( T const& v )
+    {
+        add_hash( base::hash_value( v ), 1 );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        base::for_each_batch( first, last, [this]( std::uint64_t x ){ add_hash( x, 1 ); } );
+    }
+
+    void add( T const& v, Counter count )
+    {
+        add_hash( base::hash_value( v ), count );
+    }
+
+    void add_atomic( T const& v, Counter count )
+    {
+        add_atomic_hash( base::hash_value( v ), count );
+    }
+
+    template<class It> void insert_atomic( It first, It last )
+    {
+        base::for_each_batch( first, last, [this]( std::uint64_t x ){ add_atomic_hash( x, 1 ); } );
+    }
+
+    Counter estimate( T const& v ) const
+    {
+        return estimate_hash( base::hash_value( v ) );
+    }
+
+    template<class It, class Out> Out estimate( It first, It last, Out out ) const
+    {
+        base::for_each_batch( first, last, [&]( std::uint64_t x ){ *out++ = estimate_hash( x ); } );
+        return out;
+    }
+
+    void merge( conservative_count_min_sketch const& rhs ) noexcept
+    {
+        base::merge( rhs );
+    }
+};
+
+// count_sketch
+
+template<class T, class Hash, class Counter = std::int32_t, class Flavor = default_flavor> class count_sketch: private detail::frequency_sketch_base<T, Hash, Counter, Flavor, true>
+{
+private:
+
+    using base = detail::frequency_sketch_base<T, Hash, Counter, Flavor, true>;
+
+    void add_hash( std::uint64_t x, Counter count ) noexcept
+    {
+        base::for_each_row( x, [&]( std::size_t j, int s ){ base::store( j, base::add_counter( base::load( j ), s < 0? base::negate( count ): count ) ); } );
+    }
+
+    void add_atomic_hash( std::uint64_t x, Counter count ) noexcept
+    {
+        base::for_each_row( x, [&]( std::size_t j, int s ){ base::fetch_add( j, s < 0? base::negate( count ): count ); } );
+    }
+
+    // the median of the signed row estimates
+    Counter estimate_hash( std::uint64_t x ) const noexcept
+    {
+        Counter r[ base::max_depth ] = {};
+        int n = 0;
+
+        base::for_each_row( x, [&]( std::size_t j, int s ){ Counter c = base::load( j ); r[ n++ ] = s < 0? base::negate( c ): c; } );
+
+        std::nth_element( r, r + n / 2, r + n );
+
+        if( n % 2 != 0 )
+        {
+            return r[ n / 2 ];
+        }
+
+        Counter c1 = r[ n / 2 ];
+        Counter c2 = *std::max_element( r, r + n / 2 );
+
+        return static_cast<Counter>( c1 / 2 + c2 / 2 + ( c1 % 2 + c2 % 2 ) / 2 );
+    }
+
+public:
+
+    count_sketch( std::size_t w, int d ): base( w, d )
+    {
+    }
+
+    count_sketch( std::size_t w, int d, std::uint64_t seed ): base( w, d, seed )
+    {
+    }
+
+    count_sketch( std::size_t w, int d, unsigned char const* p, std::size_t n ): base( w, d, p, n )
+    {
+    }
+
+    count_sketch( std::size_t w, int d, void const* p, std::size_t n ): count_sketch( w, d, static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    using base::width;
+    using base::depth;
+    using base::clear;
+    using base::byte_size;
+    using base::serialize;
+    using base::deserialize;
+
+    void insert( T const& v )
+    {
+        add_hash( base::hash_value( v ), 1 );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        base::for_each_batch( first, last, [this]( std::uint64_t x ){ add_hash( x, 1 ); } );
+    }
+
+    void add( T const& v, Counter count )
+    {
+        add_hash( base::hash_value( v ), count );
+    }
+
+    void add_atomic( T const& v, Counter count )
+    {
+        add_atomic_hash( base::hash_value( v ), count );
+    }
+
+    template<class It> void insert_atomic( It first, It last )
+    {
+        base::for_each_batch( first, last, [this]( std::uint64_t x ){ add_atomic_hash( x, 1 ); } );
+    }
+
+    Counter estimate( T const& v ) const
+    {
+        return estimate_hash( base::hash_value( v ) );
+    }
+
+    template<class It, class Out> Out estimate( It first, It last, Out out ) const
+    {
+        base::for_each_batch( first, last, [&]( std::uint64_t x ){ *out++ = estimate_hash( x ); } );
+        return out;
+    }
+
+    void merge( count_sketch const& rhs ) noexcept
+    {
+        base::merge( rhs );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_COUNT_MIN_SKETCH_HPP_INCLUDED
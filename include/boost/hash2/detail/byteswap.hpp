@@ -33,6 +33,11 @@ BOOST_CXX14_CONSTEXPR inline std::uint64_t byteswap_impl( std::uint64_t x ) noex
     return ( step16 & 0x00ff00ff00ff00ffull ) << 8 | ( step16 & 0xff00ff00ff00ff00ull ) >> 8;
 }
 
+BOOST_CXX14_CONSTEXPR inline std::uint16_t byteswap( std::uint16_t x ) noexcept
+{
+    return static_cast<std::uint16_t>( x << 8 | x >> 8 );
+}
+
 BOOST_CXX14_CONSTEXPR inline std::uint32_t byteswap( std::uint32_t x ) noexcept
 {
 #if defined(__GNUC__) || defined(__clang__)
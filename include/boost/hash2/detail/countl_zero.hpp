@@ -0,0 +1,55 @@
+#ifndef BOOST_HASH2_DETAIL_COUNTL_ZERO_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_COUNTL_ZERO_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// v must not be 0
+BOOST_FORCEINLINE int countl_zero( std::uint64_t v ) noexcept
+{
+#if defined(BOOST_GCC) || defined(BOOST_CLANG)
+
+    return __builtin_clzll( v );
+
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_ARM64) )
+
+    unsigned long r;
+    _BitScanReverse64( &r, v );
+
+    return 63 - static_cast<int>( r );
+
+#else
+
+    int r = 0;
+
+    while( ( v & 0x8000000000000000ull ) == 0 )
+    {
+        v <<= 1;
+        ++r;
+    }
+
+    return r;
+
+#endif
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_COUNTL_ZERO_HPP_INCLUDED
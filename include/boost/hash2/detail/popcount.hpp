@@ -0,0 +1,39 @@
+#ifndef BOOST_HASH2_DETAIL_POPCOUNT_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_POPCOUNT_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <cstdint>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+BOOST_FORCEINLINE int popcount( std::uint64_t v ) noexcept
+{
+#if defined(BOOST_GCC) || defined(BOOST_CLANG)
+
+    return __builtin_popcountll( v );
+
+#else
+
+    v = v - ( ( v >> 1 ) & 0x5555555555555555ull );
+    v = ( v & 0x3333333333333333ull ) + ( ( v >> 2 ) & 0x3333333333333333ull );
+    v = ( v + ( v >> 4 ) ) & 0x0F0F0F0F0F0F0F0Full;
+
+    return static_cast<int>( ( v * 0x0101010101010101ull ) >> 56 );
+
+#endif
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_POPCOUNT_HPP_INCLUDED
@@ -0,0 +1,42 @@
+#ifndef BOOST_HASH2_DETAIL_PREFETCH_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_PREFETCH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_MSVC) && ( defined(_M_X64) || defined(_M_IX86) )
+# include <xmmintrin.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+BOOST_FORCEINLINE void prefetch( void const* p ) noexcept
+{
+#if defined(BOOST_GCC) || defined(BOOST_CLANG)
+
+    __builtin_prefetch( p );
+
+#elif defined(BOOST_MSVC) && ( defined(_M_X64) || defined(_M_IX86) )
+
+    _mm_prefetch( static_cast<char const*>( p ), _MM_HINT_T0 );
+
+#else
+
+    (void)p;
+
+#endif
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_PREFETCH_HPP_INCLUDED
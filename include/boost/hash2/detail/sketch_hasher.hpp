@@ -0,0 +1,124 @@
+#ifndef BOOST_HASH2_DETAIL_SKETCH_HASHER_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SKETCH_HASHER_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// the formats of the serialized filters and sketches that use the
+// header of sketch_hasher
+
+constexpr std::uint32_t sketch_format_bloom = 1;
+constexpr std::uint32_t sketch_format_blocked_bloom = 2;
+constexpr std::uint32_t sketch_format_count_min = 3;
+constexpr std::uint32_t sketch_format_count = 4;
+
+// common base of the filters and sketches; holds a seeded
+// hash algorithm and maps values of type T to 64 bit hashes
+
+template<class T, class Hash, class Flavor> class sketch_hasher
+{
+private:
+
+    Hash h_;
+
+protected:
+
+    sketch_hasher() = default;
+
+    explicit sketch_hasher( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    sketch_hasher( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    void reseed( std::uint64_t seed )
+    {
+        h_ = Hash( seed );
+    }
+
+    // the header of the serialized form of a filter or sketch:
+    // 32 bit format, 32 bit parameter (the number of hash functions, or
+    // the depth), 64 bit size (in bits, blocks, or counters per row), and
+    // the 64 bit hash of an empty input, which tells the seeds apart;
+    // all little-endian
+
+    static constexpr std::size_t header_size = 24;
+
+    void write_header( unsigned char* p, std::uint32_t format, std::uint32_t k, std::uint64_t m ) const
+    {
+        Hash h( h_ );
+
+        detail::write32le( p + 0, format );
+        detail::write32le( p + 4, k );
+        detail::write64le( p + 8, m );
+        detail::write64le( p + 16, hash2::get_integral_result<std::uint64_t>( h ) );
+    }
+
+    // [p, p + header_size) must be readable
+    bool check_header( unsigned char const* p, std::uint32_t format, std::uint32_t k, std::uint64_t m ) const
+    {
+        Hash h( h_ );
+
+        return detail::read32le( p + 0 ) == format && detail::read32le( p + 4 ) == k && detail::read64le( p + 8 ) == m && detail::read64le( p + 16 ) == hash2::get_integral_result<std::uint64_t>( h );
+    }
+
+    std::uint64_t hash_value( T const& v ) const
+    {
+        Hash h( h_ );
+        hash2::hash_append( h, Flavor(), v );
+
+        return hash2::get_integral_result<std::uint64_t>( h );
+    }
+
+    // hashes the w-shingles of [first, last), the windows of w consecutive
+    // values, and calls f with each hash; a range shorter than w forms a
+    // single shingle
+
+    template<class It, class F> void for_each_shingle( It first, It last, std::size_t w, F f ) const
+    {
+        It it = first;
+
+        for( std::size_t i = 0; i < w && it != last; ++i )
+        {
+            ++it;
+        }
+
+        if( it == first ) return;
+
+        for( ;; )
+        {
+            Hash h( h_ );
+            hash2::hash_append_range( h, Flavor(), first, it );
+
+            f( hash2::get_integral_result<std::uint64_t>( h ) );
+
+            if( it == last ) break;
+
+            ++first;
+            ++it;
+        }
+    }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SKETCH_HASHER_HPP_INCLUDED
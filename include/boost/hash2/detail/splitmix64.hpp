@@ -0,0 +1,39 @@
+#ifndef BOOST_HASH2_DETAIL_SPLITMIX64_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SPLITMIX64_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <cstdint>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// the SplitMix64 finalizer, a bijective 64 bit mixing function
+
+BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t splitmix64_mix( std::uint64_t z ) noexcept
+{
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+
+    return z ^ ( z >> 31 );
+}
+
+// SplitMix64, used to expand a 64 bit seed into a sequence
+
+BOOST_CXX14_CONSTEXPR inline std::uint64_t splitmix64( std::uint64_t& x ) noexcept
+{
+    return splitmix64_mix( x += 0x9E3779B97F4A7C15ull );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SPLITMIX64_HPP_INCLUDED
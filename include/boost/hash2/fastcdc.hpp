@@ -0,0 +1,235 @@
+#ifndef BOOST_HASH2_FASTCDC_HPP_INCLUDED
+#define BOOST_HASH2_FASTCDC_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// FastCDC content-defined chunking
+//
+// Wen Xia et al, FastCDC: a Fast and Efficient Content-Defined
+// Chunking Approach for Data Deduplication, USENIX ATC 2016
+
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class H> class fastcdc
+{
+public:
+
+    using digest_type = typename H::result_type;
+
+    struct chunk
+    {
+        std::uint64_t offset;
+        std::size_t size;
+        digest_type digest;
+    };
+
+private:
+
+    // the same table as that of a default-constructed gear_64
+    detail::rolling_table table_;
+
+    H proto_;
+    H h_;
+
+    std::size_t min_size_;
+    std::size_t avg_size_;
+    std::size_t max_size_;
+
+    std::uint64_t mask_s_;
+    std::uint64_t mask_l_;
+
+    std::uint64_t offset_ = 0; // offset of the current chunk
+    std::size_t m_ = 0; // size of the current chunk so far
+    std::uint64_t g_ = 0; // Gear hash value
+
+private:
+
+    // Gear bit k depends on the last k+1 bytes, so the masks
+    // select the high bits; normalization level 2
+    static std::uint64_t high_mask( int bits )
+    {
+        if( bits < 1 ) bits = 1;
+        if( bits > 63 ) bits = 63;
+
+        return ~std::uint64_t( 0 ) << ( 64 - bits );
+    }
+
+    static int log2( std::size_t n )
+    {
+        int r = 0;
+
+        while( n > 1 )
+        {
+            n >>= 1;
+            ++r;
+        }
+
+        return r;
+    }
+
+    template<class F> void emit( F& f )
+    {
+        chunk c = { offset_, m_, h_.result() };
+
+        offset_ += m_;
+        m_ = 0;
+        g_ = 0;
+        h_ = proto_;
+
+        f( c );
+    }
+
+public:
+
+    fastcdc( std::size_t min_size, std::size_t avg_size, std::size_t max_size ): fastcdc( min_size, avg_size, max_size, H() )
+    {
+    }
+
+    fastcdc( std::size_t min_size, std::size_t avg_size, std::size_t max_size, H const& h ):
+        table_( 0 ), proto_( h ), h_( h ),
+        min_size_( min_size ), avg_size_( avg_size ), max_size_( max_size ),
+        mask_s_( high_mask( log2( avg_size ) + 2 ) ), mask_l_( high_mask( log2( avg_size ) - 2 ) )
+    {
+        BOOST_ASSERT( 0 < min_size && min_size <= avg_size && avg_size <= max_size );
+    }
+
+    std::size_t min_size() const noexcept
+    {
+        return min_size_;
+    }
+
+    std::size_t avg_size() const noexcept
+    {
+        return avg_size_;
+    }
+
+    std::size_t max_size() const noexcept
+    {
+        return max_size_;
+    }
+
+    // offset of the first byte not yet emitted as part of a chunk
+    std::uint64_t offset() const noexcept
+    {
+        return offset_;
+    }
+
+    template<class F> void update( unsigned char const* p, std::size_t n, F f )
+    {
+        while( n > 0 )
+        {
+            std::size_t i = 0;
+            std::size_t m = m_;
+
+            // cut-point skipping: no boundary can occur before min_size
+
+            if( m < min_size_ )
+            {
+                i = min_size_ - m;
+
+                if( i > n )
+                {
+                    i = n;
+                }
+
+                m += i;
+            }
+
+            std::uint64_t g = g_;
+            bool cut = false;
+
+            // before the average size, use the stricter mask
+
+            {
+                std::size_t k = avg_size_ > m? avg_size_ - m: 0;
+
+                if( k > n - i )
+                {
+                    k = n - i;
+                }
+
+                std::uint64_t const mask = mask_s_;
+
+                for( std::size_t j = i + k; i < j; )
+                {
+                    g = ( g << 1 ) + table_[ p[ i++ ] ];
+
+                    if( ( g & mask ) == 0 )
+                    {
+                        cut = true;
+                        break;
+                    }
+                }
+            }
+
+            // after the average size, use the looser one
+
+            if( !cut )
+            {
+                m = m_ + i;
+
+                std::size_t k = max_size_ - m;
+
+                if( k > n - i )
+                {
+                    k = n - i;
+                }
+
+                std::uint64_t const mask = mask_l_;
+
+                for( std::size_t j = i + k; i < j; )
+                {
+                    g = ( g << 1 ) + table_[ p[ i++ ] ];
+
+                    if( ( g & mask ) == 0 )
+                    {
+                        cut = true;
+                        break;
+                    }
+                }
+            }
+
+            h_.update( p, i );
+
+            m_ += i;
+            g_ = g;
+
+            if( cut || m_ == max_size_ )
+            {
+                emit( f );
+            }
+
+            p += i;
+            n -= i;
+        }
+    }
+
+    template<class F> void update( void const* p, std::size_t n, F f )
+    {
+        update( static_cast<unsigned char const*>( p ), n, f );
+    }
+
+    template<class F> void finish( F f )
+    {
+        if( m_ > 0 )
+        {
+            emit( f );
+        }
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_FASTCDC_HPP_INCLUDED
@@ -94,6 +94,34 @@ public:
         update( p, n );
     }
 
+    // equivalent to update() with the bytes of w in little endian order
+
+    BOOST_CXX14_CONSTEXPR void update_u32( std::uint32_t w )
+    {
+        T h = st_;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            h ^= static_cast<T>( ( w >> ( 8 * i ) ) & 0xFF );
+            h *= fnv1a_const<T>::prime;
+        }
+
+        st_ = h;
+    }
+
+    BOOST_CXX14_CONSTEXPR void update_u64( std::uint64_t w )
+    {
+        T h = st_;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h ^= static_cast<T>( ( w >> ( 8 * i ) ) & 0xFF );
+            h *= fnv1a_const<T>::prime;
+        }
+
+        st_ = h;
+    }
+
     BOOST_CXX14_CONSTEXPR T result()
     {
         T r = st_;
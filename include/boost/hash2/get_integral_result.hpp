@@ -6,6 +6,7 @@
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
 #include <type_traits>
 #include <limits>
 #include <cstddef>
@@ -41,7 +42,7 @@ constexpr typename std::enable_if<sizeof(R) == 8, std::uint64_t>::type
 // contraction
 
 template<class T, class Hash, class R = typename Hash::result_type>
-    typename std::enable_if<std::is_integral<R>::value && (sizeof(R) > sizeof(T)), T>::type
+    BOOST_CXX14_CONSTEXPR typename std::enable_if<std::is_integral<R>::value && (sizeof(R) > sizeof(T)), T>::type
     get_integral_result( Hash& h )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
@@ -60,7 +61,7 @@ template<class T, class Hash, class R = typename Hash::result_type>
 // identity
 
 template<class T, class Hash, class R = typename Hash::result_type>
-    typename std::enable_if<std::is_integral<R>::value && sizeof(R) == sizeof(T), T>::type
+    BOOST_CXX14_CONSTEXPR typename std::enable_if<std::is_integral<R>::value && sizeof(R) == sizeof(T), T>::type
     get_integral_result( Hash& h )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
@@ -77,7 +78,7 @@ template<class T, class Hash, class R = typename Hash::result_type>
 // expansion
 
 template<class T, class Hash, class R = typename Hash::result_type>
-    typename std::enable_if<std::is_integral<R>::value && (sizeof(R) < sizeof(T)), T>::type
+    BOOST_CXX14_CONSTEXPR typename std::enable_if<std::is_integral<R>::value && (sizeof(R) < sizeof(T)), T>::type
     get_integral_result( Hash& h )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
@@ -104,7 +105,7 @@ template<class T, class Hash, class R = typename Hash::result_type>
 // array-like R
 
 template<class T, class Hash, class R = typename Hash::result_type>
-    typename std::enable_if< !std::is_integral<R>::value, T >::type
+    BOOST_CXX14_CONSTEXPR typename std::enable_if< !std::is_integral<R>::value, T >::type
     get_integral_result( Hash& h )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
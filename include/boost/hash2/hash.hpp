@@ -0,0 +1,83 @@
+#ifndef BOOST_HASH2_HASH_HPP_INCLUDED
+#define BOOST_HASH2_HASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// a hash function object for unordered containers
+
+template<class T, class H, class Flavor = default_flavor> class hash
+{
+private:
+
+    // the hash algorithm, already seeded; copied on each call, which
+    // is cheaper than seeding for algorithms such as xxh3_128, siphash_64
+    H h_;
+
+private:
+
+    // a key is the only input of the hash algorithm, so contiguous
+    // ranges don't need their size appended, and are passed to
+    // hash_append_range, which hashes their storage at once when
+    // the elements are contiguously hashable
+
+    template<class = void> static void hash_append_impl( H& h, T const& v, std::true_type )
+    {
+        hash2::hash_append_range( h, Flavor(), v.data(), v.data() + v.size() );
+    }
+
+    template<class = void> static void hash_append_impl( H& h, T const& v, std::false_type )
+    {
+        hash2::hash_append( h, Flavor(), v );
+    }
+
+public:
+
+    using is_avalanching = std::true_type;
+
+    hash() = default;
+
+    explicit hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    hash( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    hash( void const* p, std::size_t n ): hash( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    explicit hash( H const& h ): h_( h )
+    {
+    }
+
+    std::size_t operator()( T const& v ) const
+    {
+        H h( h_ );
+
+        hash_append_impl( h, v, container_hash::is_contiguous_range<T>() );
+
+        return hash2::get_integral_result<std::size_t>( h );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_HPP_INCLUDED
@@ -18,7 +18,9 @@
 #include <boost/hash2/flavor.hpp>
 #include <boost/hash2/detail/is_constant_evaluated.hpp>
 #include <boost/hash2/detail/bit_cast.hpp>
+#include <boost/hash2/detail/read.hpp>
 #include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/byteswap.hpp>
 #include <boost/hash2/detail/has_tag_invoke.hpp>
 #include <boost/container_hash/is_range.hpp>
 #include <boost/container_hash/is_contiguous_range.hpp>
@@ -31,8 +33,16 @@
 #include <boost/mp11/integer_sequence.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
+#include <cstddef>
 #include <type_traits>
 #include <iterator>
+#include <tuple>
+#include <utility>
+#include <array>
+#include <vector>
+#include <deque>
+#include <bitset>
+#include <memory>
 
 #if !defined(BOOST_NO_CXX17_HDR_OPTIONAL)
 # include <optional>
@@ -55,7 +65,34 @@ namespace hash2
 namespace detail
 {
 
-template<class Hash, class Flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range_( Hash& h, Flavor const& f, It first, It last )
+// floating point values, and integers in non-native byte order, which
+// are hashed a block at a time (see "ranges of words" below)
+
+template<class T, endian E> struct is_word_range_element: std::integral_constant<bool,
+    ( std::is_floating_point<T>::value && ( sizeof(T) == 4 || sizeof(T) == 8 ) ) ||
+    ( ( std::is_integral<T>::value || std::is_enum<T>::value ) && ( sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 ) && !is_contiguously_hashable<T, E>::value )>
+{
+};
+
+// iterators of std::deque, whose elements are stored in contiguous
+// blocks; a range of them is hashed a block at a time when the blocks
+// can be passed to hash_append_range as T*
+
+template<class It, endian E, class V = typename std::iterator_traits<It>::value_type,
+    bool = !std::is_pointer<It>::value && !std::is_array<V>::value && ( is_contiguously_hashable<V, E>::value || is_word_range_element<V, E>::value )>
+struct is_deque_iterator: std::false_type
+{
+};
+
+template<class It, endian E, class V> struct is_deque_iterator<It, E, V, true>: std::integral_constant<bool,
+    std::is_same<It, typename std::deque<V>::iterator>::value || std::is_same<It, typename std::deque<V>::const_iterator>::value>
+{
+};
+
+template<class Hash, class Flavor, class It>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< !is_deque_iterator<It, Flavor::byte_order>::value, void >::type
+    hash_append_range_( Hash& h, Flavor const& f, It first, It last )
 {
     for( ; first != last; ++first )
     {
@@ -107,6 +144,179 @@ template<class Hash, class Flavor, class T>
 
 #endif
 
+// described classes without bases, whose members are contiguously
+// hashable and add up to the size of the class, have no padding; their
+// storage is the same as the message when the members are described
+// in declaration order, which can only be checked at run time
+
+#if defined(BOOST_DESCRIBE_CXX14)
+
+template<class T, class D> using described_member_type = typename std::remove_reference<decltype( std::declval<T const&>().*D::pointer )>::type;
+
+template<class T, endian E, bool = container_hash::is_described_class<T>::value> struct is_packed_described_class: std::false_type
+{
+};
+
+template<class T, endian E> struct is_packed_described_class<T, E, true>
+{
+    using Bd = describe::describe_bases<T, describe::mod_any_access>;
+    using Md = describe::describe_members<T, describe::mod_any_access>;
+
+    template<class D> using is_member_contiguously_hashable = is_contiguously_hashable<described_member_type<T, D>, E>;
+    template<class D> using member_size = mp11::mp_size_t<sizeof( described_member_type<T, D> )>;
+
+    static constexpr bool value = mp11::mp_empty<Bd>::value && !mp11::mp_empty<Md>::value &&
+        mp11::mp_all_of<Md, is_member_contiguously_hashable>::value &&
+        mp11::mp_apply<mp11::mp_plus, mp11::mp_transform<member_size, Md>>::value == sizeof(T);
+};
+
+// never constexpr
+
+template<class T> bool has_declaration_order_layout( T const& v )
+{
+    using Md = describe::describe_members<T, describe::mod_any_access>;
+
+    unsigned char const* p = reinterpret_cast<unsigned char const*>( &v );
+
+    std::size_t offset = 0;
+    bool r = true;
+
+    mp11::mp_for_each<Md>([&](auto D){
+
+        std::size_t k = static_cast<std::size_t>( reinterpret_cast<unsigned char const*>( &(v.*D.pointer) ) - p );
+
+        r = r && k == offset;
+        offset += sizeof( v.*D.pointer );
+
+    });
+
+    return r;
+}
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if<
+        !is_contiguously_hashable<T, Flavor::byte_order>::value &&
+        is_packed_described_class<typename std::remove_cv<T>::type, Flavor::byte_order>::value, void >::type
+    hash_append_range_( Hash& h, Flavor const& f, T* first, T* last )
+{
+    if( !detail::is_constant_evaluated() && first != last && detail::has_declaration_order_layout( *first ) )
+    {
+        h.update( first, (last - first) * sizeof(T) );
+    }
+    else
+    {
+        for( ; first != last; ++first )
+        {
+            hash2::hash_append( h, f, *first );
+        }
+    }
+}
+
+#endif // defined(BOOST_DESCRIBE_CXX14)
+
+// ranges of words
+//
+// Floating point values, hashed as the bits of v + 0 (which maps -0.0 to
+// +0.0), and integers in a byte order other than the native one aren't
+// contiguously hashable. A range of them is converted a block at a time
+// into a local buffer, byteswapped if Flavor::byte_order isn't native,
+// in a loop the compiler can vectorize, and each block is passed to
+// Hash::update at once.
+
+template<class U, class T> BOOST_FORCEINLINE U range_word( T const& v, std::true_type /*is_floating_point*/ )
+{
+    return detail::bit_cast<U>( v + 0 );
+}
+
+template<class U, class T> BOOST_FORCEINLINE U range_word( T const& v, std::false_type /*is_floating_point*/ )
+{
+    return static_cast<U>( v );
+}
+
+// never constexpr
+
+template<class U, endian E, class T> BOOST_FORCEINLINE void convert_word_range( U* dst, T const* src, std::size_t n )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        U w = detail::range_word<U>( src[ i ], std::is_floating_point<T>() );
+        dst[ i ] = E == endian::native? w: detail::byteswap( w );
+    }
+}
+
+// never constexpr
+
+template<class Hash, class Flavor, class T> void hash_append_word_range( Hash& h, Flavor const& /*f*/, T const* first, T const* last )
+{
+    using U = typename std::conditional<sizeof(T) == 2, std::uint16_t,
+        typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type>::type;
+
+    constexpr std::size_t K = 512 / sizeof(U);
+    U tmp[ K ];
+
+    // full blocks have a constant trip count, which helps vectorization
+
+    while( static_cast<std::size_t>( last - first ) >= K )
+    {
+        detail::convert_word_range<U, Flavor::byte_order>( tmp, first, K );
+        h.update( tmp, K * sizeof(U) );
+
+        first += K;
+    }
+
+    std::size_t n = static_cast<std::size_t>( last - first );
+
+    if( n != 0 )
+    {
+        detail::convert_word_range<U, Flavor::byte_order>( tmp, first, n );
+        h.update( tmp, n * sizeof(U) );
+    }
+}
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if<
+        is_word_range_element<typename std::remove_cv<T>::type, Flavor::byte_order>::value, void >::type
+    hash_append_range_( Hash& h, Flavor const& f, T* first, T* last )
+{
+    if( !detail::is_constant_evaluated() )
+    {
+        detail::hash_append_word_range( h, f, first, last );
+    }
+    else
+    {
+        for( ; first != last; ++first )
+        {
+            hash2::hash_append( h, f, *first );
+        }
+    }
+}
+
+// std::deque iterators; each run of elements at consecutive addresses,
+// normally a block, is passed to hash_append_range as T const*
+// never constexpr
+
+template<class Hash, class Flavor, class It>
+    typename std::enable_if< is_deque_iterator<It, Flavor::byte_order>::value, void >::type
+    hash_append_range_( Hash& h, Flavor const& f, It first, It last )
+{
+    using T = typename std::iterator_traits<It>::value_type;
+
+    while( first != last )
+    {
+        T const* p = std::addressof( *first );
+        std::size_t n = 1;
+
+        for( ++first; first != last && std::addressof( *first ) == p + n; ++first )
+        {
+            ++n;
+        }
+
+        hash2::hash_append_range( h, f, p, p + n );
+    }
+}
+
 } // namespace detail
 
 template<class Hash, class Flavor = default_flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range( Hash& h, Flavor const& f, It first, It last )
@@ -176,6 +386,46 @@ template<class Hash, class Flavor = default_flavor, class It> BOOST_CXX14_CONSTE
 namespace detail
 {
 
+// word update hooks
+//
+// A hash algorithm may provide update_u32( std::uint32_t w ) and
+// update_u64( std::uint64_t w ), equivalent to passing the bytes
+// of w, in little endian order, to update. Integers of the same
+// size (and enums with such an underlying type) are then passed
+// to these instead of to update, avoiding the buffering of their
+// bytes.
+
+template<class Hash, class En = void> struct has_update_u32: std::false_type
+{
+};
+
+template<class Hash> struct has_update_u32<Hash, decltype( std::declval<Hash&>().update_u32( std::uint32_t() ), void() )>: std::true_type
+{
+};
+
+template<class Hash, class En = void> struct has_update_u64: std::false_type
+{
+};
+
+template<class Hash> struct has_update_u64<Hash, decltype( std::declval<Hash&>().update_u64( std::uint64_t() ), void() )>: std::true_type
+{
+};
+
+template<class Hash, class T> struct has_update_word: std::integral_constant<bool,
+    ( std::is_integral<T>::value || std::is_enum<T>::value ) && ( ( sizeof(T) == 4 && has_update_u32<Hash>::value ) || ( sizeof(T) == 8 && has_update_u64<Hash>::value ) )>
+{
+};
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_word( Hash& h, endian e, std::uint32_t w )
+{
+    h.update_u32( e == endian::little? w: detail::byteswap( w ) );
+}
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_word( Hash& h, endian e, std::uint64_t w )
+{
+    h.update_u64( e == endian::little? w: detail::byteswap( w ) );
+}
+
 // integral types
 
 template<class Hash, class Flavor, class T>
@@ -257,11 +507,42 @@ template<class Hash, class Flavor, class T>
     hash2::hash_append_size( h, f, v.size() );
 }
 
+// segmented containers and ranges, w/ size
+//
+// A range whose segments() member function returns a range of
+// contiguous ranges, holding its elements in order, is hashed a
+// segment at a time. The result is the same as for other ranges.
+
+template<class T, class En = void> struct is_segmented_range: std::false_type
+{
+};
+
+template<class T> struct is_segmented_range<T, decltype( std::declval<T const&>().segments().begin()->data(), std::declval<T const&>().segments().begin()->size(), void() )>:
+    std::integral_constant<bool, container_hash::is_range<T>::value && !has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value && !container_hash::is_unordered_range<T>::value>
+{
+};
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< is_segmented_range<T>::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, T const& v )
+{
+    std::size_t m = 0;
+
+    for( auto const& s: v.segments() )
+    {
+        hash2::hash_append_range( h, f, s.data(), s.data() + s.size() );
+        m += s.size();
+    }
+
+    hash2::hash_append_size( h, f, m );
+}
+
 // containers and ranges, w/ size
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_range<T>::value && !has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value && !container_hash::is_unordered_range<T>::value, void >::type
+    typename std::enable_if< container_hash::is_range<T>::value && !has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value && !container_hash::is_unordered_range<T>::value && !is_segmented_range<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
     hash2::hash_append_range_and_size( h, f, v.begin(), v.end() );
@@ -309,6 +590,85 @@ template<class Hash, class Flavor, class T>
     }
 }
 
+// std::vector<bool>, std::bitset
+//
+// Bit i is stored in bit i % 8 of byte i / 8, with the unused bits of
+// the last byte zero, regardless of the byte order of the platform and
+// of Flavor. The bits are packed 64 at a time into a word, which is
+// written into a local buffer that is passed to Hash::update at once.
+
+template<std::size_t N> struct bitset_iterator
+{
+    std::bitset<N> const* p_;
+    std::size_t i_;
+
+    BOOST_CXX14_CONSTEXPR bool operator*() const
+    {
+        return (*p_)[ i_ ];
+    }
+
+    BOOST_CXX14_CONSTEXPR bitset_iterator& operator++()
+    {
+        ++i_;
+        return *this;
+    }
+};
+
+template<class Hash, class It> BOOST_CXX14_CONSTEXPR void hash_append_bits( Hash& h, It first, std::size_t n )
+{
+    unsigned char tmp[ 512 ] = {};
+    std::size_t m = 0;
+
+    for( std::size_t i = 0; i < n; i += 64 )
+    {
+        std::size_t k = n - i < 64? n - i: 64;
+
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; j < k; ++j, ++first )
+        {
+            w |= static_cast<std::uint64_t>( *first ) << j;
+        }
+
+        detail::write64le( tmp + m, w );
+        m += ( k + 7 ) / 8;
+
+        if( m == sizeof( tmp ) )
+        {
+            h.update( tmp, m );
+            m = 0;
+        }
+    }
+
+    if( m != 0 )
+    {
+        h.update( tmp, m );
+    }
+}
+
+template<class Hash, class Flavor, class A>
+    BOOST_CXX14_CONSTEXPR
+    void do_hash_append( Hash& h, Flavor const& f, std::vector<bool, A> const& v )
+{
+    detail::hash_append_bits( h, v.begin(), v.size() );
+    hash2::hash_append_size( h, f, v.size() );
+}
+
+template<class Hash, class Flavor, std::size_t N>
+    BOOST_CXX14_CONSTEXPR
+    void do_hash_append( Hash& h, Flavor const& f, std::bitset<N> const& v )
+{
+    if( N == 0 )
+    {
+        // A hash_append call must always result in a call to Hash::update
+        hash2::hash_append( h, f, '\x00' );
+    }
+    else
+    {
+        detail::hash_append_bits( h, detail::bitset_iterator<N>{ &v, 0 }, N );
+    }
+}
+
 #if defined(BOOST_MSVC)
 # pragma warning(pop)
 #endif
@@ -323,13 +683,149 @@ template<class Hash, class Flavor, class T>
     hash2::hash_append_unordered_range( h, f, v.begin(), v.end() );
 }
 
+// runs of members
+//
+// Adjacent elements of a std::tuple, std::pair or std::array, or members
+// of a described class, that are contiguously hashable produce the same
+// bytes as the storage they occupy, when not separated by padding, so a
+// run of such members is passed to Hash::update at once. Whether a member
+// can join a run is decided at compile time; whether it's adjacent to the
+// previous one is checked on the addresses, which the compiler folds to
+// constants.
+
+struct member_run
+{
+    unsigned char const* base_ = nullptr;
+
+    // [first_, last_) are offsets from base_, the address of the object
+    std::size_t first_ = 0;
+    std::size_t last_ = 0;
+};
+
+// a run that consists of a single word is passed to the word update hooks
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_run_u32( Hash& h, unsigned char const* p, std::true_type )
+{
+    h.update_u32( detail::read32le( p ) );
+}
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_run_u32( Hash& h, unsigned char const* p, std::false_type )
+{
+    h.update( p, 4 );
+}
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_run_u64( Hash& h, unsigned char const* p, std::true_type )
+{
+    h.update_u64( detail::read64le( p ) );
+}
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void update_run_u64( Hash& h, unsigned char const* p, std::false_type )
+{
+    h.update( p, 8 );
+}
+
+template<class Hash> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void flush_member_run( Hash& h, member_run& r )
+{
+    std::size_t n = r.last_ - r.first_;
+
+    if( n == 4 )
+    {
+        detail::update_run_u32( h, r.base_ + r.first_, has_update_u32<Hash>() );
+    }
+    else if( n == 8 )
+    {
+        detail::update_run_u64( h, r.base_ + r.first_, has_update_u64<Hash>() );
+    }
+    else if( n != 0 )
+    {
+        h.update( r.base_ + r.first_, n );
+    }
+
+    r.first_ = r.last_;
+}
+
+// the member at pm, of size n, is a subobject of the object at pw;
+// using offsets instead of addresses lets the compiler fold the
+// adjacency checks even when it hoists the address computations
+// never constexpr
+
+template<class Hash> BOOST_FORCEINLINE void append_member_run( Hash& h, member_run& r, void const* pw, void const* pm, std::size_t n )
+{
+    unsigned char const* base = static_cast<unsigned char const*>( pw );
+    std::size_t offset = static_cast<std::size_t>( static_cast<unsigned char const*>( pm ) - base );
+
+    if( r.first_ == r.last_ || r.last_ != offset )
+    {
+        detail::flush_member_run( h, r );
+
+        r.base_ = base;
+        r.first_ = offset;
+    }
+
+    r.last_ = offset + n;
+}
+
+// v is a subobject of w; it can join a run when it's an lvalue and
+// contiguously hashable
+
+template<class Hash, class Flavor, class W, class T> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void hash_append_member( Hash& h, Flavor const& f, member_run& r, W const& w, T&& v )
+{
+    using U = typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+
+    if( !detail::is_constant_evaluated() && std::is_lvalue_reference<T>::value && is_contiguously_hashable<U, Flavor::byte_order>::value )
+    {
+        detail::append_member_run( h, r, &w, &v, sizeof(U) );
+    }
+    else
+    {
+        detail::flush_member_run( h, r );
+        hash2::hash_append( h, f, v );
+    }
+}
+
 // tuple-likes
 
+// the elements of std::tuple, std::pair and std::array are subobjects,
+// unless they are references; the get of another tuple-like, or of the
+// tuple of references that std::tie returns, may refer to unrelated
+// objects, whose offsets from the tuple can't be computed
+
+template<class T> struct has_element_subobjects: std::false_type
+{
+};
+
+template<class... T> struct has_element_subobjects< std::tuple<T...> >: mp11::mp_none_of< mp11::mp_list<T...>, std::is_reference >
+{
+};
+
+template<class T1, class T2> struct has_element_subobjects< std::pair<T1, T2> >: mp11::mp_none_of< mp11::mp_list<T1, T2>, std::is_reference >
+{
+};
+
+template<class T, std::size_t N> struct has_element_subobjects< std::array<T, N> >: std::true_type
+{
+};
+
+template<class Hash, class Flavor, class W, class T> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void hash_append_element( Hash& h, Flavor const& f, member_run& r, W const& w, T&& v, std::true_type )
+{
+    detail::hash_append_member( h, f, r, w, std::forward<T>( v ) );
+}
+
+template<class Hash, class Flavor, class W, class T> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void hash_append_element( Hash& h, Flavor const& f, member_run& /*r*/, W const& /*w*/, T&& v, std::false_type )
+{
+    hash2::hash_append( h, f, v );
+}
+
 template<class Hash, class Flavor, class T, std::size_t... J> BOOST_CXX14_CONSTEXPR void hash_append_tuple( Hash& h, Flavor const& f, T const& v, mp11::integer_sequence<std::size_t, J...> )
 {
     using std::get;
-    int a[] = { ((void)hash2::hash_append( h, f, get<J>(v) ), 0)... };
+
+    member_run r;
+
+    int a[] = { ((void)detail::hash_append_element( h, f, r, v, get<J>(v), has_element_subobjects<T>() ), 0)... };
     (void)a;
+
+    detail::flush_member_run( h, r );
 }
 
 template<class Hash, class Flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_tuple( Hash& h, Flavor const& f, T const& /*v*/, mp11::integer_sequence<std::size_t> )
@@ -412,12 +908,14 @@ template<class Hash, class Flavor, class T>
 
     std::size_t r = 0;
 
+    member_run run;
+
     using Bd = describe::describe_bases<T, describe::mod_any_access>;
 
     mp11::mp_for_each<Bd>([&](auto D){
 
         using B = typename decltype(D)::type;
-        hash2::hash_append( h, f, (B const&)v );
+        detail::hash_append_member( h, f, run, v, (B const&)v );
         ++r;
 
     });
@@ -426,11 +924,13 @@ template<class Hash, class Flavor, class T>
 
     mp11::mp_for_each<Md>([&](auto D){
 
-        hash2::hash_append( h, f, v.*D.pointer );
+        detail::hash_append_member( h, f, run, v, v.*D.pointer );
         ++r;
 
     });
 
+    detail::flush_member_run( h, run );
+
     // A hash_append call must always result in a call to Hash::update
 
     if( r == 0 )
@@ -497,12 +997,13 @@ template<class Hash, class Flavor, class T>
     tag_invoke( hash_append_tag(), hash_append_provider(), h, f, &v );
 }
 
-} // namespace detail
-
-// hash_append
+template<class Hash, class Flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_( Hash& h, Flavor const& /*f*/, T const& v, std::true_type )
+{
+    using U = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+    detail::update_word( h, Flavor::byte_order, static_cast<U>( v ) );
+}
 
-template<class Hash, class Flavor = default_flavor, class T>
-BOOST_CXX14_CONSTEXPR void hash_append( Hash& h, Flavor const& f, T const& v )
+template<class Hash, class Flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_( Hash& h, Flavor const& f, T const& v, std::false_type )
 {
     if( !detail::is_constant_evaluated() && is_contiguously_hashable<T, Flavor::byte_order>::value )
     {
@@ -514,6 +1015,16 @@ BOOST_CXX14_CONSTEXPR void hash_append( Hash& h, Flavor const& f, T const& v )
     }
 }
 
+} // namespace detail
+
+// hash_append
+
+template<class Hash, class Flavor = default_flavor, class T>
+BOOST_CXX14_CONSTEXPR void hash_append( Hash& h, Flavor const& f, T const& v )
+{
+    detail::hash_append_( h, f, v, detail::has_update_word<Hash, T>() );
+}
+
 } // namespace hash2
 } // namespace boost
 
@@ -0,0 +1,308 @@
+#ifndef BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
+#define BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_bytes.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class K> unsigned char const* batch_key_data( K const& k )
+{
+    return reinterpret_cast<unsigned char const*>( k.data() );
+}
+
+template<class K> std::size_t batch_key_size( K const& k )
+{
+    return k.size() * sizeof( *k.data() );
+}
+
+// generic: copy a seeded prototype per key, so that the cost
+// of seed processing is paid once per batch
+
+template<class H> struct hash_batch_impl
+{
+    template<class It, class Out> static Out fn( It first, It last, Out out, std::uint64_t seed )
+    {
+        H const h0( seed );
+
+        for( ; first != last; ++first )
+        {
+            H h( h0 );
+            h.update( detail::batch_key_data( *first ), detail::batch_key_size( *first ) );
+
+            *out++ = h.result();
+        }
+
+        return out;
+    }
+};
+
+// groups of four keys are hashed together by the kernels below, to
+// give the processor four independent dependency chains to overlap
+
+template<class R, class It, class Out, class F> Out hash_batch_4( It first, It last, Out out, F const& f )
+{
+    using key_type = typename std::iterator_traits<It>::value_type;
+
+    for( ;; )
+    {
+        It i0 = first;
+        if( i0 == last ) break;
+
+        It i1 = i0; ++i1;
+        if( i1 == last ) break;
+
+        It i2 = i1; ++i2;
+        if( i2 == last ) break;
+
+        It i3 = i2; ++i3;
+        if( i3 == last ) break;
+
+        key_type const& k0 = *i0;
+        key_type const& k1 = *i1;
+        key_type const& k2 = *i2;
+        key_type const& k3 = *i3;
+
+        R r[ 4 ];
+
+        f.hash4(
+            detail::batch_key_data( k0 ), detail::batch_key_size( k0 ),
+            detail::batch_key_data( k1 ), detail::batch_key_size( k1 ),
+            detail::batch_key_data( k2 ), detail::batch_key_size( k2 ),
+            detail::batch_key_data( k3 ), detail::batch_key_size( k3 ),
+            r );
+
+        *out++ = r[ 0 ];
+        *out++ = r[ 1 ];
+        *out++ = r[ 2 ];
+        *out++ = r[ 3 ];
+
+        first = ++i3;
+    }
+
+    for( ; first != last; ++first )
+    {
+        *out++ = f.hash1( detail::batch_key_data( *first ), detail::batch_key_size( *first ) );
+    }
+
+    return out;
+}
+
+// FNV-1a: the four keys are processed in lockstep over their common length
+
+template<class T> struct fnv1a_batch_kernel
+{
+    T basis;
+
+    explicit fnv1a_batch_kernel( std::uint64_t seed ): basis( fnv1a_const<T>::basis )
+    {
+        if( seed )
+        {
+            for( int i = 0; i < 8; ++i )
+            {
+                basis ^= static_cast<T>( ( seed >> ( 8 * i ) ) & 0xFF );
+                basis *= fnv1a_const<T>::prime;
+            }
+        }
+    }
+
+    static T tail( T h, unsigned char const* p, std::size_t n )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            h ^= static_cast<T>( p[i] );
+            h *= fnv1a_const<T>::prime;
+        }
+
+        return h;
+    }
+
+    T hash1( unsigned char const* p, std::size_t n ) const
+    {
+        return tail( basis, p, n );
+    }
+
+    void hash4(
+        unsigned char const* p0, std::size_t n0, unsigned char const* p1, std::size_t n1,
+        unsigned char const* p2, std::size_t n2, unsigned char const* p3, std::size_t n3,
+        T (&r)[ 4 ] ) const
+    {
+        std::size_t m = n0;
+
+        if( n1 < m ) m = n1;
+        if( n2 < m ) m = n2;
+        if( n3 < m ) m = n3;
+
+        T h0 = basis, h1 = basis, h2 = basis, h3 = basis;
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            h0 = ( h0 ^ p0[ i ] ) * fnv1a_const<T>::prime;
+            h1 = ( h1 ^ p1[ i ] ) * fnv1a_const<T>::prime;
+            h2 = ( h2 ^ p2[ i ] ) * fnv1a_const<T>::prime;
+            h3 = ( h3 ^ p3[ i ] ) * fnv1a_const<T>::prime;
+        }
+
+        r[ 0 ] = tail( h0, p0 + m, n0 - m );
+        r[ 1 ] = tail( h1, p1 + m, n1 - m );
+        r[ 2 ] = tail( h2, p2 + m, n2 - m );
+        r[ 3 ] = tail( h3, p3 + m, n3 - m );
+    }
+};
+
+template<> struct hash_batch_impl<fnv1a_32>
+{
+    template<class It, class Out> static Out fn( It first, It last, Out out, std::uint64_t seed )
+    {
+        return detail::hash_batch_4<std::uint32_t>( first, last, out, fnv1a_batch_kernel<std::uint32_t>( seed ) );
+    }
+};
+
+template<> struct hash_batch_impl<fnv1a_64>
+{
+    template<class It, class Out> static Out fn( It first, It last, Out out, std::uint64_t seed )
+    {
+        return detail::hash_batch_4<std::uint64_t>( first, last, out, fnv1a_batch_kernel<std::uint64_t>( seed ) );
+    }
+};
+
+// SipHash-2-4: each key is a single dependency chain, so the four keys
+// are processed in lockstep over their common number of 8 byte blocks;
+// the rest of each key is then finished by hash_bytes
+
+struct siphash_batch_kernel
+{
+    std::uint64_t seed;
+
+    explicit siphash_batch_kernel( std::uint64_t s ): seed( s )
+    {
+    }
+
+    BOOST_FORCEINLINE std::uint64_t hash1( unsigned char const* p, std::size_t n ) const
+    {
+        return hash_bytes_impl<siphash_64>::fn( p, n, seed );
+    }
+
+    void hash4(
+        unsigned char const* p0, std::size_t n0, unsigned char const* p1, std::size_t n1,
+        unsigned char const* p2, std::size_t n2, unsigned char const* p3, std::size_t n3,
+        std::uint64_t (&r)[ 4 ] ) const
+    {
+        std::size_t m = n0;
+
+        if( n1 < m ) m = n1;
+        if( n2 < m ) m = n2;
+        if( n3 < m ) m = n3;
+
+        std::size_t const k = m / 8;
+
+        siphash_64 h0( seed ), h1( seed ), h2( seed ), h3( seed );
+
+        for( std::size_t i = 0; i < 8 * k; i += 8 )
+        {
+            h0.update_( p0 + i );
+            h1.update_( p1 + i );
+            h2.update_( p2 + i );
+            h3.update_( p3 + i );
+        }
+
+        r[ 0 ] = hash_bytes_impl<siphash_64>::finish( h0, p0, n0, k );
+        r[ 1 ] = hash_bytes_impl<siphash_64>::finish( h1, p1, n1, k );
+        r[ 2 ] = hash_bytes_impl<siphash_64>::finish( h2, p2, n2, k );
+        r[ 3 ] = hash_bytes_impl<siphash_64>::finish( h3, p3, n3, k );
+    }
+};
+
+template<> struct hash_batch_impl<siphash_64>
+{
+    template<class It, class Out> static Out fn( It first, It last, Out out, std::uint64_t seed )
+    {
+        return detail::hash_batch_4<std::uint64_t>( first, last, out, siphash_batch_kernel( seed ) );
+    }
+};
+
+// XXH64 already keeps four independent accumulators per key, and gains
+// nothing from lockstep processing; each key is hashed by hash_bytes,
+// which reads directly from the key instead of through a buffer
+
+template<> struct hash_batch_impl<xxhash_64>
+{
+    template<class It, class Out> static Out fn( It first, It last, Out out, std::uint64_t seed )
+    {
+        for( ; first != last; ++first )
+        {
+            *out++ = hash_bytes_impl<xxhash_64>::fn( detail::batch_key_data( *first ), detail::batch_key_size( *first ), seed );
+        }
+
+        return out;
+    }
+};
+
+// XXH3-128: the code path depends on the key length, so keys are hashed
+// one at a time; keys of up to 240 bytes go to hash_bytes, which doesn't
+// derive a secret from the seed, and longer keys use a copy of a seeded
+// prototype
+
+template<> struct hash_batch_impl<xxh3_128>
+{
+    template<class It, class Out> static Out fn( It first, It last, Out out, std::uint64_t seed )
+    {
+        xxh3_128 const h0( seed );
+
+        for( ; first != last; ++first )
+        {
+            unsigned char const* p = detail::batch_key_data( *first );
+            std::size_t n = detail::batch_key_size( *first );
+
+            if( n <= 240 )
+            {
+                *out++ = hash_bytes_impl<xxh3_128>::fn_short( p, n, seed );
+            }
+            else
+            {
+                xxh3_128 h( h0 );
+                h.update( p, n );
+
+                *out++ = h.result();
+            }
+        }
+
+        return out;
+    }
+};
+
+} // namespace detail
+
+// hash_batch
+
+template<class H, class R, class Out> Out hash_batch( R const& keys, Out out, std::uint64_t seed )
+{
+    return detail::hash_batch_impl<H>::fn( keys.begin(), keys.end(), out, seed );
+}
+
+template<class H, class R, class Out> Out hash_batch( R const& keys, Out out )
+{
+    return detail::hash_batch_impl<H>::fn( keys.begin(), keys.end(), out, 0 );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
@@ -0,0 +1,218 @@
+#ifndef BOOST_HASH2_HASH_BYTES_HPP_INCLUDED
+#define BOOST_HASH2_HASH_BYTES_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// generic: the streaming interface
+
+template<class H> struct hash_bytes_impl
+{
+    static BOOST_CXX14_CONSTEXPR typename H::result_type fn( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        H h( seed );
+        h.update( p, n );
+
+        return h.result();
+    }
+};
+
+// XXH64, reading directly from the input instead of through the 32 byte buffer
+
+template<> struct hash_bytes_impl<xxhash_64>
+{
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t fn( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        xxhash_64 h( seed );
+
+        std::size_t const k = n / 32;
+
+        h.update_( p, k );
+        h.n_ = n;
+
+        return xxhash_64::avalanche( xxhash_64::mix_tail( h.converge(), p + 32 * k, n % 32 ) );
+    }
+};
+
+// SipHash-2-4, reading directly from the input instead of through the 8 byte buffer
+
+template<> struct hash_bytes_impl<siphash_64>
+{
+    // h has already consumed the first i blocks of [p, p + n)
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t finish( siphash_64& h, unsigned char const* p, std::size_t n, std::size_t i )
+    {
+        std::uint64_t m = static_cast<std::uint64_t>( n & 0xFF ) << 56;
+
+        p += 8 * i;
+        n -= 8 * i;
+
+        while( n >= 8 )
+        {
+            h.update_( p );
+
+            p += 8;
+            n -= 8;
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            m |= static_cast<std::uint64_t>( p[ i ] ) << ( 8 * i );
+        }
+
+        return h.finalize_( m );
+    }
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t fn( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        siphash_64 h( seed );
+        return finish( h, p, n, 0 );
+    }
+};
+
+// XXH3-128; inputs of up to 240 bytes don't use the seed-derived
+// secret, so are hashed without constructing an xxh3_128 object
+
+template<> struct hash_bytes_impl<xxh3_128>
+{
+    static BOOST_CXX14_CONSTEXPR digest<16> fn_short( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        BOOST_ASSERT( n <= 240 );
+
+        unsigned char const* secret = xxh3_128_constants<>::default_secret;
+
+        if( n == 0 )
+        {
+            return xxh3_128::xxh3_128_digest_empty( secret, seed );
+        }
+        else if( n < 4 )
+        {
+            return xxh3_128::xxh3_128_digest_1to3( secret, seed, p, n );
+        }
+        else if( n < 9 )
+        {
+            return xxh3_128::xxh3_128_digest_4to8( secret, seed, p, n );
+        }
+        else if( n < 17 )
+        {
+            return xxh3_128::xxh3_128_digest_9to16( secret, seed, p, n );
+        }
+        else if( n < 129 )
+        {
+            return xxh3_128::xxh3_128_digest_17to128( secret, seed, p, n );
+        }
+        else
+        {
+            return xxh3_128::xxh3_128_digest_129to240( secret, seed, p, n );
+        }
+    }
+
+    static BOOST_CXX14_CONSTEXPR digest<16> fn( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        if( n <= 240 )
+        {
+            return fn_short( p, n, seed );
+        }
+
+        xxh3_128 h( seed );
+        h.update( p, n );
+
+        return h.result();
+    }
+};
+
+// SHA2-256, processing the full blocks directly from the input, and
+// the padded last block(s) from a local buffer
+
+template<> struct hash_bytes_impl<sha2_256>
+{
+    static BOOST_CXX14_CONSTEXPR digest<32> fn( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        sha2_256 h( seed );
+
+        std::uint64_t const bits = ( h.n_ + n ) * 8;
+
+        while( n >= 64 )
+        {
+            sha2_256::transform( p, h.state_ );
+
+            p += 64;
+            n -= 64;
+        }
+
+        unsigned char block[ 128 ] = {};
+
+        detail::memcpy( block, p, n );
+        block[ n ] = 0x80;
+
+        std::size_t k = n < 56? 64: 128;
+
+        detail::write64be( block + k - 8, bits );
+
+        sha2_256::transform( block, h.state_ );
+
+        if( k == 128 )
+        {
+            sha2_256::transform( block + 64, h.state_ );
+        }
+
+        digest<32> r;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32be( r.data() + i * 4, h.state_[ i ] );
+        }
+
+        return r;
+    }
+};
+
+} // namespace detail
+
+// hash_bytes
+
+template<class H> BOOST_CXX14_CONSTEXPR typename H::result_type hash_bytes( unsigned char const* p, std::size_t n, std::uint64_t seed )
+{
+    return detail::hash_bytes_impl<H>::fn( p, n, seed );
+}
+
+template<class H> BOOST_CXX14_CONSTEXPR typename H::result_type hash_bytes( unsigned char const* p, std::size_t n )
+{
+    return detail::hash_bytes_impl<H>::fn( p, n, 0 );
+}
+
+template<class H> typename H::result_type hash_bytes( void const* p, std::size_t n, std::uint64_t seed )
+{
+    return detail::hash_bytes_impl<H>::fn( static_cast<unsigned char const*>( p ), n, seed );
+}
+
+template<class H> typename H::result_type hash_bytes( void const* p, std::size_t n )
+{
+    return detail::hash_bytes_impl<H>::fn( static_cast<unsigned char const*>( p ), n, 0 );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_BYTES_HPP_INCLUDED
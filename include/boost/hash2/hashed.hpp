@@ -0,0 +1,86 @@
+#ifndef BOOST_HASH2_HASHED_HPP_INCLUDED
+#define BOOST_HASH2_HASHED_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/config.hpp>
+#include <utility>
+
+namespace boost
+{
+namespace hash2
+{
+
+// an immutable value along with its digest, computed once on construction;
+// hash_append appends the digest instead of the value, so hashing an
+// object that contains it doesn't depend on the size of the value
+
+template<class T, class Hash, class Flavor = default_flavor> class hashed
+{
+public:
+
+    using value_type = T;
+    using result_type = typename Hash::result_type;
+
+private:
+
+    T v_;
+    result_type r_;
+
+private:
+
+    static BOOST_CXX14_CONSTEXPR result_type digest_of( T const& v )
+    {
+        Hash h;
+        hash2::hash_append( h, Flavor(), v );
+
+        return h.result();
+    }
+
+public:
+
+    BOOST_CXX14_CONSTEXPR explicit hashed( T const& v ): v_( v ), r_( digest_of( v_ ) )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit hashed( T&& v ): v_( std::move( v ) ), r_( digest_of( v_ ) )
+    {
+    }
+
+    constexpr T const& get() const noexcept
+    {
+        return v_;
+    }
+
+    constexpr result_type const& digest() const noexcept
+    {
+        return r_;
+    }
+
+    template<class Provider, class Hash2, class Flavor2>
+    friend BOOST_CXX14_CONSTEXPR void tag_invoke( hash_append_tag const&, Provider const&, Hash2& h, Flavor2 const& f, hashed const* v )
+    {
+        Provider::hash_append( h, f, v->r_ );
+    }
+};
+
+// comparisons; the digests are compared first, as a quick rejection test
+
+template<class T, class Hash, class Flavor> BOOST_CXX14_CONSTEXPR bool operator==( hashed<T, Hash, Flavor> const& a, hashed<T, Hash, Flavor> const& b )
+{
+    return a.digest() == b.digest() && a.get() == b.get();
+}
+
+template<class T, class Hash, class Flavor> BOOST_CXX14_CONSTEXPR bool operator!=( hashed<T, Hash, Flavor> const& a, hashed<T, Hash, Flavor> const& b )
+{
+    return !( a == b );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASHED_HPP_INCLUDED
@@ -0,0 +1,471 @@
+#ifndef BOOST_HASH2_HYPERLOGLOG_HPP_INCLUDED
+#define BOOST_HASH2_HYPERLOGLOG_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HyperLogLog
+//
+// Philippe Flajolet et al, HyperLogLog: the analysis of a
+// near-optimal cardinality estimation algorithm
+//
+// Otmar Ertl, New cardinality estimation algorithms for
+// HyperLogLog sketches, arXiv:1702.01284
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/sketch_hasher.hpp>
+#include <boost/hash2/detail/countl_zero.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// Ertl's improved estimator, computed from the register histogram
+
+inline double hll_sigma( double x )
+{
+    if( x == 1 ) return std::numeric_limits<double>::infinity();
+
+    double y = 1;
+    double z = x;
+
+    for( ;; )
+    {
+        x *= x;
+
+        double z2 = z + x * y;
+        y += y;
+
+        if( z2 == z ) return z;
+
+        z = z2;
+    }
+}
+
+inline double hll_tau( double x )
+{
+    if( x == 0 || x == 1 ) return 0;
+
+    double y = 1;
+    double z = 1 - x;
+
+    for( ;; )
+    {
+        x = std::sqrt( x );
+        y *= 0.5;
+
+        double z2 = z - ( 1 - x ) * ( 1 - x ) * y;
+
+        if( z2 == z ) return z / 3;
+
+        z = z2;
+    }
+}
+
+// c[0..q+1] is the histogram of the register values
+inline double hll_estimate( std::size_t const* c, int q, std::size_t m )
+{
+    double const dm = static_cast<double>( m );
+
+    double z = dm * hll_tau( 1 - static_cast<double>( c[ q + 1 ] ) / dm );
+
+    for( int k = q; k >= 1; --k )
+    {
+        z = 0.5 * ( z + static_cast<double>( c[ k ] ) );
+    }
+
+    z += dm * hll_sigma( static_cast<double>( c[ 0 ] ) / dm );
+
+    // 1 / ( 2 ln 2 )
+    double const alpha = 0.72134752044448170368;
+
+    return alpha * dm * dm / z;
+}
+
+} // namespace detail
+
+template<class T, class Hash, int Precision = 14, class Flavor = default_flavor> class hyperloglog: private detail::sketch_hasher<T, Hash, Flavor>
+{
+private:
+
+    static_assert( Precision >= 4 && Precision <= 18, "Precision must be between 4 and 18" );
+
+    using base = detail::sketch_hasher<T, Hash, Flavor>;
+
+    static constexpr std::size_t m = std::size_t( 1 ) << Precision;
+    static constexpr int q = 64 - Precision;
+
+    // above this number of distinct registers, the sparse
+    // representation is no smaller than the dense one
+    static constexpr std::size_t sparse_limit = m / 4;
+
+    static constexpr unsigned char format_sparse = 1;
+    static constexpr unsigned char format_dense = 2;
+
+private:
+
+    // sparse representation: entries index << 8 | rank, the first
+    // sorted_ of them sorted and with unique indices, the rest unsorted
+    std::vector<std::uint32_t> sparse_;
+    std::size_t sorted_ = 0;
+
+    // dense representation: one byte per register; empty when sparse
+    std::vector<unsigned char> dense_;
+
+private:
+
+    void insert_hash( std::uint64_t h )
+    {
+        std::uint32_t i = static_cast<std::uint32_t>( h >> q );
+        unsigned char r = static_cast<unsigned char>( detail::countl_zero( ( h << Precision ) | ( std::uint64_t( 1 ) << ( Precision - 1 ) ) ) + 1 );
+
+        if( dense_.empty() )
+        {
+            sparse_.push_back( i << 8 | r );
+
+            if( sparse_.size() >= 2 * sorted_ + 64 )
+            {
+                compact();
+            }
+        }
+        else if( dense_[ i ] < r )
+        {
+            dense_[ i ] = r;
+        }
+    }
+
+    static void compact( std::vector<std::uint32_t>& v )
+    {
+        std::sort( v.begin(), v.end() );
+
+        // for equal indices, keep the last (largest) rank
+
+        std::size_t j = 0;
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            if( i + 1 < v.size() && ( v[ i ] >> 8 ) == ( v[ i + 1 ] >> 8 ) ) continue;
+            v[ j++ ] = v[ i ];
+        }
+
+        v.resize( j );
+    }
+
+    void compact()
+    {
+        compact( sparse_ );
+        sorted_ = sparse_.size();
+
+        if( sorted_ > sparse_limit )
+        {
+            to_dense();
+        }
+    }
+
+    static void to_dense( std::vector<std::uint32_t> const& v, std::vector<unsigned char>& d )
+    {
+        d.assign( m, 0 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            std::uint32_t e = v[ i ];
+            unsigned char r = static_cast<unsigned char>( e & 0xFF );
+
+            if( d[ e >> 8 ] < r )
+            {
+                d[ e >> 8 ] = r;
+            }
+        }
+    }
+
+    void to_dense()
+    {
+        to_dense( sparse_, dense_ );
+
+        std::vector<std::uint32_t>().swap( sparse_ );
+        sorted_ = 0;
+    }
+
+public:
+
+    static constexpr int precision = Precision;
+
+    hyperloglog() = default;
+
+    explicit hyperloglog( std::uint64_t seed ): base( seed )
+    {
+    }
+
+    hyperloglog( unsigned char const* p, std::size_t n ): base( p, n )
+    {
+    }
+
+    hyperloglog( void const* p, std::size_t n ): hyperloglog( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    bool is_sparse() const noexcept
+    {
+        return dense_.empty();
+    }
+
+    void clear() noexcept
+    {
+        sparse_.clear();
+        sorted_ = 0;
+
+        std::vector<unsigned char>().swap( dense_ );
+    }
+
+    void insert( T const& v )
+    {
+        insert_hash( base::hash_value( v ) );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            insert_hash( base::hash_value( *first ) );
+        }
+    }
+
+    double estimate() const
+    {
+        std::size_t c[ q + 2 ] = {};
+
+        if( dense_.empty() )
+        {
+            std::vector<std::uint32_t> v( sparse_ );
+            compact( v );
+
+            c[ 0 ] = m - v.size();
+
+            for( std::size_t i = 0; i < v.size(); ++i )
+            {
+                ++c[ v[ i ] & 0xFF ];
+            }
+        }
+        else
+        {
+            for( std::size_t i = 0; i < m; ++i )
+            {
+                ++c[ dense_[ i ] ];
+            }
+        }
+
+        return detail::hll_estimate( c, q, m );
+    }
+
+    // union; both sketches must have the same seed
+    void merge( hyperloglog const& rhs )
+    {
+        if( rhs.dense_.empty() )
+        {
+            if( dense_.empty() )
+            {
+                sparse_.insert( sparse_.end(), rhs.sparse_.begin(), rhs.sparse_.end() );
+                compact();
+            }
+            else
+            {
+                for( std::size_t i = 0; i < rhs.sparse_.size(); ++i )
+                {
+                    std::uint32_t e = rhs.sparse_[ i ];
+                    unsigned char r = static_cast<unsigned char>( e & 0xFF );
+
+                    if( dense_[ e >> 8 ] < r )
+                    {
+                        dense_[ e >> 8 ] = r;
+                    }
+                }
+            }
+        }
+        else
+        {
+            if( dense_.empty() )
+            {
+                to_dense();
+            }
+
+            // a branch-free byte-wise maximum, which compilers vectorize
+
+            unsigned char* p = dense_.data();
+            unsigned char const* q2 = rhs.dense_.data();
+
+            for( std::size_t i = 0; i < m; ++i )
+            {
+                p[ i ] = p[ i ] < q2[ i ]? q2[ i ]: p[ i ];
+            }
+        }
+    }
+
+    // serialization
+    //
+    // byte 0: format (1 sparse, 2 dense); byte 1: precision, then
+    // sparse: 32 bit little-endian entry count, and 3 byte little-endian
+    //   entries index << 6 | rank, sorted by index
+    // dense: the registers, 6 bits each, four registers per 3 bytes
+    //
+    // The unsorted tail of sparse_ may take the number of distinct
+    // registers above sparse_limit before the next compaction switches
+    // to dense; such a sketch is written in the dense format, which is
+    // smaller, and is the only one deserialize accepts for it.
+
+    std::size_t serialized_size() const
+    {
+        if( dense_.empty() )
+        {
+            std::vector<std::uint32_t> v( sparse_ );
+            compact( v );
+
+            if( v.size() <= sparse_limit )
+            {
+                return 6 + 3 * v.size();
+            }
+        }
+
+        return 2 + m / 4 * 3;
+    }
+
+    // returns the number of bytes written, serialized_size()
+    std::size_t serialize( unsigned char* p ) const
+    {
+        unsigned char* p0 = p;
+
+        std::vector<unsigned char> d;
+        unsigned char const* r = dense_.data();
+
+        if( dense_.empty() )
+        {
+            std::vector<std::uint32_t> v( sparse_ );
+            compact( v );
+
+            if( v.size() <= sparse_limit )
+            {
+                *p++ = format_sparse;
+                *p++ = Precision;
+
+                detail::write32le( p, static_cast<std::uint32_t>( v.size() ) );
+                p += 4;
+
+                for( std::size_t i = 0; i < v.size(); ++i, p += 3 )
+                {
+                    std::uint32_t e = ( v[ i ] >> 8 ) << 6 | ( v[ i ] & 0x3F );
+
+                    p[ 0 ] = static_cast<unsigned char>( e & 0xFF );
+                    p[ 1 ] = static_cast<unsigned char>( ( e >> 8 ) & 0xFF );
+                    p[ 2 ] = static_cast<unsigned char>( ( e >> 16 ) & 0xFF );
+                }
+
+                return static_cast<std::size_t>( p - p0 );
+            }
+
+            to_dense( v, d );
+            r = d.data();
+        }
+
+        *p++ = format_dense;
+        *p++ = Precision;
+
+        for( std::size_t i = 0; i < m; i += 4, p += 3 )
+        {
+            std::uint32_t w = r[ i ] | r[ i + 1 ] << 6 | r[ i + 2 ] << 12 | r[ i + 3 ] << 18;
+
+            p[ 0 ] = static_cast<unsigned char>( w & 0xFF );
+            p[ 1 ] = static_cast<unsigned char>( ( w >> 8 ) & 0xFF );
+            p[ 2 ] = static_cast<unsigned char>( ( w >> 16 ) & 0xFF );
+        }
+
+        return static_cast<std::size_t>( p - p0 );
+    }
+
+    // replaces the contents with the deserialized sketch; returns
+    // false, leaving *this unchanged, if [p, p+n) is malformed
+    bool deserialize( unsigned char const* p, std::size_t n )
+    {
+        if( n < 2 || p[ 1 ] != Precision ) return false;
+
+        if( p[ 0 ] == format_sparse )
+        {
+            if( n < 6 ) return false;
+
+            std::uint32_t k = detail::read32le( p + 2 );
+
+            if( k > sparse_limit || n != 6 + 3 * static_cast<std::size_t>( k ) ) return false;
+
+            std::vector<std::uint32_t> v( k );
+
+            p += 6;
+
+            for( std::size_t i = 0; i < k; ++i, p += 3 )
+            {
+                std::uint32_t e = p[ 0 ] | p[ 1 ] << 8 | static_cast<std::uint32_t>( p[ 2 ] ) << 16;
+
+                std::uint32_t j = e >> 6;
+                std::uint32_t r = e & 0x3F;
+
+                if( j >= m || r == 0 || r > static_cast<std::uint32_t>( q + 1 ) ) return false;
+                if( i > 0 && j <= ( v[ i - 1 ] >> 8 ) ) return false;
+
+                v[ i ] = j << 8 | r;
+            }
+
+            sparse_.swap( v );
+            sorted_ = sparse_.size();
+
+            std::vector<unsigned char>().swap( dense_ );
+
+            return true;
+        }
+        else if( p[ 0 ] == format_dense )
+        {
+            if( n != 2 + m / 4 * 3 ) return false;
+
+            std::vector<unsigned char> v( m );
+
+            p += 2;
+
+            for( std::size_t i = 0; i < m; i += 4, p += 3 )
+            {
+                std::uint32_t w = p[ 0 ] | p[ 1 ] << 8 | static_cast<std::uint32_t>( p[ 2 ] ) << 16;
+
+                for( std::size_t j = 0; j < 4; ++j, w >>= 6 )
+                {
+                    v[ i + j ] = static_cast<unsigned char>( w & 0x3F );
+
+                    if( v[ i + j ] > q + 1 ) return false;
+                }
+            }
+
+            dense_.swap( v );
+
+            sparse_.clear();
+            sorted_ = 0;
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HYPERLOGLOG_HPP_INCLUDED
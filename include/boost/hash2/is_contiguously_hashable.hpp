@@ -9,6 +9,8 @@
 #include <boost/hash2/is_endian_independent.hpp>
 #include <boost/hash2/endian.hpp>
 #include <type_traits>
+#include <utility>
+#include <array>
 #include <cstddef>
 
 namespace boost
@@ -26,6 +28,31 @@ template<class T, std::size_t N, endian E> struct is_contiguously_hashable<T[N],
 {
 };
 
+// std::pair and std::array hash their elements in storage order, so are
+// contiguously hashable when their elements are and there's no padding
+
+template<class T1, class T2, endian E> struct is_contiguously_hashable<std::pair<T1, T2>, E>:
+    std::integral_constant<bool, is_contiguously_hashable<T1, E>::value && is_contiguously_hashable<T2, E>::value && sizeof( std::pair<T1, T2> ) == sizeof( T1 ) + sizeof( T2 )>
+{
+};
+
+template<class T1, class T2, endian E> struct is_contiguously_hashable<std::pair<T1, T2> const, E>:
+    is_contiguously_hashable<std::pair<T1, T2>, E>
+{
+};
+
+// std::array<T, 0> is hashed as a single zero byte
+
+template<class T, std::size_t N, endian E> struct is_contiguously_hashable<std::array<T, N>, E>:
+    std::integral_constant<bool, N != 0 && is_contiguously_hashable<T, E>::value && sizeof( std::array<T, N> ) == N * sizeof( T )>
+{
+};
+
+template<class T, std::size_t N, endian E> struct is_contiguously_hashable<std::array<T, N> const, E>:
+    is_contiguously_hashable<std::array<T, N>, E>
+{
+};
+
 } // namespace hash2
 } // namespace boost
 
@@ -0,0 +1,257 @@
+#ifndef BOOST_HASH2_MERKLE_TREE_HPP_INCLUDED
+#define BOOST_HASH2_MERKLE_TREE_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Merkle trees
+//
+// RFC 6962, Certificate Transparency, Section 2.1
+
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class Hash> class merkle_tree
+{
+public:
+
+    using digest_type = typename Hash::result_type;
+
+private:
+
+    // the nodes, in level order; levels_[ 0 ] holds the leaf hashes, and
+    // the last level the root. A level of odd size has its last node
+    // promoted unchanged to the next level, which gives the RFC 6962
+    // tree shape
+
+    std::vector< std::vector<digest_type> > levels_;
+
+    // the leaves changed since the last commit
+    std::vector<std::size_t> dirty_;
+
+private:
+
+    static digest_type hash_node( digest_type const& l, digest_type const& r )
+    {
+        unsigned char const prefix = 0x01;
+
+        Hash h;
+
+        h.update( &prefix, 1 );
+        h.update( l.data(), l.size() );
+        h.update( r.data(), r.size() );
+
+        return h.result();
+    }
+
+    // recomputes node i of level k + 1 from its children
+    void update_parent( std::size_t k, std::size_t i )
+    {
+        std::vector<digest_type> const& c = levels_[ k ];
+
+        levels_[ k + 1 ][ i ] = 2 * i + 1 < c.size()? hash_node( c[ 2 * i ], c[ 2 * i + 1 ] ): c[ 2 * i ];
+    }
+
+    void build()
+    {
+        for( std::size_t k = 0; levels_[ k ].size() > 1; ++k )
+        {
+            std::size_t m = ( levels_[ k ].size() + 1 ) / 2;
+
+            levels_.emplace_back( m );
+
+            for( std::size_t i = 0; i < m; ++i )
+            {
+                update_parent( k, i );
+            }
+        }
+    }
+
+public:
+
+    static digest_type hash_leaf( void const* p, std::size_t n )
+    {
+        unsigned char const prefix = 0x00;
+
+        Hash h;
+
+        h.update( &prefix, 1 );
+        h.update( p, n );
+
+        return h.result();
+    }
+
+    merkle_tree(): levels_( 1 )
+    {
+    }
+
+    // builds the tree over the blocks in [first, last); a block b
+    // must have contiguous storage accessible via b.data(), b.size()
+
+    template<class It> merkle_tree( It first, It last ): levels_( 1 )
+    {
+        for( ; first != last; ++first )
+        {
+            levels_[ 0 ].push_back( hash_leaf( first->data(), first->size() * sizeof( *first->data() ) ) );
+        }
+
+        build();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return levels_[ 0 ].size();
+    }
+
+    // levels
+
+    std::size_t level_count() const noexcept
+    {
+        return levels_.size();
+    }
+
+    std::size_t level_size( std::size_t k ) const noexcept
+    {
+        BOOST_ASSERT( k < levels_.size() );
+        return levels_[ k ].size();
+    }
+
+    digest_type const& node( std::size_t k, std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( k < levels_.size() && i < levels_[ k ].size() );
+        return levels_[ k ][ i ];
+    }
+
+    // modification; the changes are applied to the inner
+    // nodes on the next call to commit()
+
+    void update( std::size_t i, void const* p, std::size_t n )
+    {
+        BOOST_ASSERT( i < size() );
+
+        levels_[ 0 ][ i ] = hash_leaf( p, n );
+        dirty_.push_back( i );
+    }
+
+    void push_back( void const* p, std::size_t n )
+    {
+        levels_[ 0 ].push_back( hash_leaf( p, n ) );
+        dirty_.push_back( size() - 1 );
+    }
+
+    bool committed() const noexcept
+    {
+        return dirty_.empty();
+    }
+
+    // recomputes the paths from the changed leaves to the root, level by
+    // level, so that an ancestor shared by several of them is rehashed
+    // once; O(k log n) for k changed leaves
+
+    void commit()
+    {
+        std::vector<std::size_t> d;
+        d.swap( dirty_ );
+
+        for( std::size_t k = 0; !d.empty() && levels_[ k ].size() > 1; ++k )
+        {
+            std::size_t m = ( levels_[ k ].size() + 1 ) / 2;
+
+            if( k + 1 == levels_.size() )
+            {
+                levels_.emplace_back( m );
+            }
+            else
+            {
+                levels_[ k + 1 ].resize( m );
+            }
+
+            std::sort( d.begin(), d.end() );
+
+            std::size_t j = 0;
+
+            for( std::size_t i = 0; i < d.size(); ++i )
+            {
+                std::size_t p = d[ i ] / 2;
+
+                if( j > 0 && d[ j - 1 ] == p ) continue;
+
+                update_parent( k, p );
+                d[ j++ ] = p;
+            }
+
+            d.resize( j );
+        }
+    }
+
+    // the tree head; Hash().result() for the empty tree
+
+    digest_type root() const
+    {
+        BOOST_ASSERT( committed() );
+
+        if( size() == 0 )
+        {
+            return Hash().result();
+        }
+
+        return levels_.back()[ 0 ];
+    }
+
+    // the inclusion proof (audit path) of leaf i, the sibling
+    // nodes from the leaf up, in RFC 6962 order
+
+    template<class Out> Out inclusion_proof( std::size_t i, Out out ) const
+    {
+        BOOST_ASSERT( committed() );
+        BOOST_ASSERT( i < size() );
+
+        for( std::size_t k = 0; k + 1 < levels_.size(); ++k, i /= 2 )
+        {
+            std::size_t j = i ^ 1;
+
+            if( j < levels_[ k ].size() )
+            {
+                *out++ = levels_[ k ][ j ];
+            }
+        }
+
+        return out;
+    }
+
+    // verifies that [first, last) is an inclusion proof of the leaf
+    // hash lh at index i in a tree of n leaves with the given root
+
+    template<class It> static bool verify_inclusion( digest_type const& lh, std::size_t i, std::size_t n, It first, It last, digest_type const& root )
+    {
+        if( i >= n ) return false;
+
+        digest_type r = lh;
+
+        for( ; n > 1; i /= 2, n = ( n + 1 ) / 2 )
+        {
+            if( ( i ^ 1 ) >= n ) continue;
+
+            if( first == last ) return false;
+
+            r = ( i & 1 )? hash_node( *first, r ): hash_node( r, *first );
+            ++first;
+        }
+
+        return first == last && r == root;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MERKLE_TREE_HPP_INCLUDED
@@ -0,0 +1,133 @@
+#ifndef BOOST_HASH2_MINHASH_HPP_INCLUDED
+#define BOOST_HASH2_MINHASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// MinHash
+//
+// Andrei Z. Broder, On the resemblance and containment of documents
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/sketch_hasher.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/assert.hpp>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class T, class Hash, std::size_t K, class Flavor = default_flavor> class minhash: private detail::sketch_hasher<T, Hash, Flavor>
+{
+private:
+
+    static_assert( K > 0, "K must be positive" );
+
+    using base = detail::sketch_hasher<T, Hash, Flavor>;
+
+    std::array<std::uint64_t, K> sig_;
+
+private:
+
+    // the K hash functions are x -> mix( x + ( i + 1 ) * gamma ), with mix
+    // a bijection, i.e. K SplitMix64 outputs seeded with x; the loop has
+    // no dependencies between lanes, and compilers vectorize it
+
+    void insert_hash( std::uint64_t x ) noexcept
+    {
+        std::uint64_t* p = sig_.data();
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            std::uint64_t v = detail::splitmix64_mix( x + ( i + 1 ) * 0x9E3779B97F4A7C15ull );
+            p[ i ] = v < p[ i ]? v: p[ i ];
+        }
+    }
+
+public:
+
+    static constexpr std::size_t signature_size = K;
+
+    minhash()
+    {
+        clear();
+    }
+
+    explicit minhash( std::uint64_t seed ): base( seed )
+    {
+        clear();
+    }
+
+    minhash( unsigned char const* p, std::size_t n ): base( p, n )
+    {
+        clear();
+    }
+
+    minhash( void const* p, std::size_t n ): minhash( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    void clear() noexcept
+    {
+        sig_.fill( ~std::uint64_t( 0 ) );
+    }
+
+    void insert( T const& v )
+    {
+        insert_hash( base::hash_value( v ) );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            insert_hash( base::hash_value( *first ) );
+        }
+    }
+
+    template<class It> void insert_shingles( It first, It last, std::size_t w )
+    {
+        BOOST_ASSERT( w > 0 );
+
+        base::for_each_shingle( first, last, w, [this]( std::uint64_t x ){ insert_hash( x ); } );
+    }
+
+    // union; both sketches must have the same seed
+    void merge( minhash const& rhs ) noexcept
+    {
+        std::uint64_t* p = sig_.data();
+        std::uint64_t const* q = rhs.sig_.data();
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            p[ i ] = q[ i ] < p[ i ]? q[ i ]: p[ i ];
+        }
+    }
+
+    std::array<std::uint64_t, K> const& signature() const noexcept
+    {
+        return sig_;
+    }
+
+    double jaccard( minhash const& rhs ) const noexcept
+    {
+        std::size_t n = 0;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            n += sig_[ i ] == rhs.sig_[ i ];
+        }
+
+        return static_cast<double>( n ) / K;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MINHASH_HPP_INCLUDED
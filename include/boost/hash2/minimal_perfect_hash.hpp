@@ -0,0 +1,502 @@
+#ifndef BOOST_HASH2_MINIMAL_PERFECT_HASH_HPP_INCLUDED
+#define BOOST_HASH2_MINIMAL_PERFECT_HASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Minimal perfect hashing
+//
+// Antoine Limasset, Guillaume Rizk, Rayan Chikhi, Pierre Peterlongo,
+// Fast and scalable minimal perfect hashing for massive key sets (BBHash)
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/hash2/detail/popcount.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// serialized layout, a sequence of 64 bit little-endian words:
+//
+// format tag
+// seed
+// number of keys
+// number of levels L
+// L level sizes, in bits, each a multiple of 64
+// zero words, padding the header to a multiple of 8 words
+// the bit arrays of the levels, concatenated and split into blocks
+//   of 448 bits; each block is preceded by a rank word, the number
+//   of set bits before it, so that, when the representation is 64
+//   byte aligned, a lookup and its rank computation touch a single
+//   64 byte cache line
+
+constexpr std::uint64_t mphf_format_tag = 0x3146485050324842ull; // "BH2PPHF1"
+constexpr std::size_t mphf_max_levels = 64;
+constexpr std::size_t mphf_header_words = 4;
+constexpr std::size_t mphf_block_words = 8; // including the rank word
+
+// the size of the header, in words, for L levels
+constexpr std::size_t mphf_header_size( std::size_t levels ) noexcept
+{
+    return ( mphf_header_words + levels + mphf_block_words - 1 ) / mphf_block_words * mphf_block_words;
+}
+
+// the position of a key with hash value x in a level of m bits
+inline std::uint64_t mphf_position( std::uint64_t x, std::size_t level, std::uint64_t m ) noexcept
+{
+    return detail::mul128( detail::splitmix64_mix( x + ( level + 1 ) * 0x9E3779B97F4A7C15ull ), m ).high;
+}
+
+inline void mphf_set( std::vector<std::uint64_t>& w, std::uint64_t i ) noexcept
+{
+    w[ i / 64 ] |= std::uint64_t( 1 ) << ( i % 64 );
+}
+
+inline bool mphf_test( std::vector<std::uint64_t> const& w, std::uint64_t i ) noexcept
+{
+    return ( w[ i / 64 ] >> ( i % 64 ) ) & 1;
+}
+
+// builds the layout from distinct hash values, consuming them; returns
+// false if the keys couldn't be placed within mphf_max_levels levels
+
+inline bool mphf_build( std::vector<std::uint64_t>& h, std::uint64_t seed, double gamma, std::vector<unsigned char>& out )
+{
+    std::size_t const n = h.size();
+
+    std::vector<std::uint64_t> sizes;
+    std::vector<std::uint64_t> bits;
+
+    std::vector<std::uint64_t> a, c;
+
+    for( std::size_t level = 0; !h.empty(); ++level )
+    {
+        if( level == mphf_max_levels ) return false;
+
+        std::uint64_t m = static_cast<std::uint64_t>( gamma * static_cast<double>( h.size() ) );
+        m = ( m + 63 ) / 64 * 64;
+
+        if( m == 0 ) m = 64;
+
+        // a: positions with at least one key, c: with more than one
+
+        a.assign( m / 64, 0 );
+        c.assign( m / 64, 0 );
+
+        for( std::size_t i = 0; i < h.size(); ++i )
+        {
+            std::uint64_t p = mphf_position( h[ i ], level, m );
+
+            if( mphf_test( a, p ) )
+            {
+                mphf_set( c, p );
+            }
+            else
+            {
+                mphf_set( a, p );
+            }
+        }
+
+        for( std::size_t i = 0; i < a.size(); ++i )
+        {
+            a[ i ] &= ~c[ i ];
+        }
+
+        // the keys that collided move to the next level
+
+        std::size_t j = 0;
+
+        for( std::size_t i = 0; i < h.size(); ++i )
+        {
+            if( !mphf_test( a, mphf_position( h[ i ], level, m ) ) )
+            {
+                h[ j++ ] = h[ i ];
+            }
+        }
+
+        h.resize( j );
+
+        sizes.push_back( m );
+        bits.insert( bits.end(), a.begin(), a.end() );
+    }
+
+    std::size_t const nb = ( bits.size() + mphf_block_words - 2 ) / ( mphf_block_words - 1 );
+
+    out.assign( 8 * ( mphf_header_size( sizes.size() ) + nb * mphf_block_words ), 0 );
+
+    unsigned char* p = out.data();
+
+    detail::write64le( p, mphf_format_tag ); p += 8;
+    detail::write64le( p, seed ); p += 8;
+    detail::write64le( p, n ); p += 8;
+    detail::write64le( p, sizes.size() ); p += 8;
+
+    for( std::size_t i = 0; i < sizes.size(); ++i, p += 8 )
+    {
+        detail::write64le( p, sizes[ i ] );
+    }
+
+    p = out.data() + 8 * mphf_header_size( sizes.size() );
+
+    std::uint64_t r = 0;
+
+    for( std::size_t i = 0; i < bits.size(); ++i )
+    {
+        std::size_t const k = i % ( mphf_block_words - 1 );
+
+        if( k == 0 )
+        {
+            detail::write64le( p, r );
+        }
+
+        detail::write64le( p + 8 * ( k + 1 ), bits[ i ] );
+        r += detail::popcount( bits[ i ] );
+
+        if( k == mphf_block_words - 2 )
+        {
+            p += 8 * mphf_block_words;
+        }
+    }
+
+    return true;
+}
+
+} // namespace detail
+
+// minimal_perfect_hash_view
+
+template<class T, class Hash, class Flavor = default_flavor> class minimal_perfect_hash_view
+{
+private:
+
+    Hash h_;
+
+    std::uint64_t size_ = 0;
+    std::size_t levels_ = 0;
+
+    std::uint64_t level_size_[ detail::mphf_max_levels ];
+    std::uint64_t level_offset_[ detail::mphf_max_levels ];
+
+    unsigned char const* blocks_ = nullptr;
+
+private:
+
+    // the word containing bit i, and the number of set bits before it
+
+    std::uint64_t word( std::uint64_t i ) const noexcept
+    {
+        std::uint64_t const w = i / 64;
+        return detail::read64le( blocks_ + 8 * ( w / ( detail::mphf_block_words - 1 ) * detail::mphf_block_words + w % ( detail::mphf_block_words - 1 ) + 1 ) );
+    }
+
+    std::uint64_t rank( std::uint64_t i ) const noexcept
+    {
+        std::uint64_t const w = i / 64;
+
+        unsigned char const* p = blocks_ + 8 * ( w / ( detail::mphf_block_words - 1 ) * detail::mphf_block_words );
+        std::uint64_t const k = w % ( detail::mphf_block_words - 1 );
+
+        std::uint64_t r = detail::read64le( p );
+
+        for( std::uint64_t j = 0; j < k; ++j )
+        {
+            r += detail::popcount( detail::read64le( p + 8 * ( j + 1 ) ) );
+        }
+
+        return r + detail::popcount( detail::read64le( p + 8 * ( k + 1 ) ) & ( ( std::uint64_t( 1 ) << ( i % 64 ) ) - 1 ) );
+    }
+
+public:
+
+    minimal_perfect_hash_view() noexcept
+    {
+    }
+
+    // attaches the view to the serialized representation [p, p+n), which
+    // must stay valid and need not be aligned; returns false, leaving
+    // *this unchanged, if [p, p+n) is malformed
+
+    bool attach( unsigned char const* p, std::size_t n )
+    {
+        if( n % 8 != 0 || n / 8 < detail::mphf_header_words ) return false;
+
+        std::uint64_t const nw = n / 8;
+
+        if( detail::read64le( p ) != detail::mphf_format_tag ) return false;
+
+        std::uint64_t seed = detail::read64le( p + 8 );
+        std::uint64_t size = detail::read64le( p + 16 );
+        std::uint64_t levels = detail::read64le( p + 24 );
+
+        if( levels > detail::mphf_max_levels || nw < detail::mphf_header_words + levels ) return false;
+
+        std::uint64_t level_size[ detail::mphf_max_levels ];
+        std::uint64_t level_offset[ detail::mphf_max_levels ];
+
+        std::uint64_t total = 0; // words
+
+        for( std::size_t i = 0; i < levels; ++i )
+        {
+            std::uint64_t m = detail::read64le( p + 8 * ( detail::mphf_header_words + i ) );
+
+            if( m == 0 || m % 64 != 0 || m / 64 > nw ) return false;
+
+            level_size[ i ] = m;
+            level_offset[ i ] = total * 64;
+
+            total += m / 64;
+        }
+
+        std::uint64_t const nb = ( total + detail::mphf_block_words - 2 ) / ( detail::mphf_block_words - 1 );
+
+        std::size_t const hw = detail::mphf_header_size( static_cast<std::size_t>( levels ) );
+
+        if( nw != hw + nb * detail::mphf_block_words ) return false;
+
+        for( std::size_t i = detail::mphf_header_words + levels; i < hw; ++i )
+        {
+            if( detail::read64le( p + 8 * i ) != 0 ) return false;
+        }
+
+        unsigned char const* blocks = p + 8 * hw;
+
+        // the number of keys is the total number of set bits
+
+        {
+            std::uint64_t r = 0;
+
+            if( nb > 0 )
+            {
+                unsigned char const* q = blocks + 8 * ( nb - 1 ) * detail::mphf_block_words;
+
+                r = detail::read64le( q );
+
+                for( std::size_t j = 1; j < detail::mphf_block_words; ++j )
+                {
+                    r += detail::popcount( detail::read64le( q + 8 * j ) );
+                }
+            }
+
+            if( r != size ) return false;
+        }
+
+        h_ = Hash( seed );
+
+        size_ = size;
+        levels_ = static_cast<std::size_t>( levels );
+
+        std::memcpy( level_size_, level_size, levels_ * sizeof( std::uint64_t ) );
+        std::memcpy( level_offset_, level_offset, levels_ * sizeof( std::uint64_t ) );
+
+        blocks_ = blocks;
+
+        return true;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>( size_ );
+    }
+
+    // for a key in the set, returns its unique index in [0, size());
+    // for any other value, an unspecified index in [0, size()), or 0
+    // when the set is empty
+
+    std::size_t operator()( T const& v ) const
+    {
+        Hash h( h_ );
+        hash2::hash_append( h, Flavor(), v );
+
+        std::uint64_t const x = hash2::get_integral_result<std::uint64_t>( h );
+
+        for( std::size_t i = 0; i < levels_; ++i )
+        {
+            std::uint64_t j = level_offset_[ i ] + detail::mphf_position( x, i, level_size_[ i ] );
+
+            if( ( word( j ) >> ( j % 64 ) ) & 1 )
+            {
+                return static_cast<std::size_t>( rank( j ) );
+            }
+        }
+
+        return size_ == 0? 0: static_cast<std::size_t>( x % size_ );
+    }
+};
+
+// minimal_perfect_hash
+
+template<class T, class Hash, class Flavor = default_flavor> class minimal_perfect_hash
+{
+private:
+
+    // the serialized representation, stored at a 64 byte aligned offset
+    // in storage_, so that each block occupies a single cache line
+
+    std::vector<unsigned char> storage_;
+    std::size_t offset_ = 0;
+    std::size_t n_ = 0;
+
+    minimal_perfect_hash_view<T, Hash, Flavor> view_;
+
+private:
+
+    void assign( unsigned char const* p, std::size_t n )
+    {
+        storage_.assign( n + 63, 0 );
+
+        std::uintptr_t const a = reinterpret_cast<std::uintptr_t>( storage_.data() );
+
+        offset_ = static_cast<std::size_t>( ( 64 - a % 64 ) % 64 );
+        n_ = n;
+
+        std::memcpy( storage_.data() + offset_, p, n );
+
+        attach();
+    }
+
+    void attach()
+    {
+        BOOST_ASSERT( reinterpret_cast<std::uintptr_t>( data() ) % 64 == 0 );
+
+        bool r = view_.attach( data(), n_ );
+
+        BOOST_ASSERT( r );
+        (void)r;
+    }
+
+public:
+
+    // the mapping of the empty set
+
+    minimal_perfect_hash()
+    {
+        std::vector<std::uint64_t> h;
+        std::vector<unsigned char> w;
+
+        detail::mphf_build( h, 0, 2.0, w );
+        assign( w.data(), w.size() );
+    }
+
+    // builds the mapping of the set of distinct keys in [first, last);
+    // It must be a forward iterator, as the keys are rehashed with a
+    // new seed when two of them have the same 64 bit hash value
+
+    template<class It> minimal_perfect_hash( It first, It last, std::uint64_t seed = 0, double gamma = 2.0 )
+    {
+        BOOST_ASSERT( gamma >= 1.0 );
+
+        std::vector<std::uint64_t> h;
+        std::vector<unsigned char> w;
+
+        for( int attempt = 1;; ++attempt )
+        {
+            Hash const h0( seed );
+
+            h.clear();
+
+            for( It it = first; it != last; ++it )
+            {
+                Hash h1( h0 );
+                hash2::hash_append( h1, Flavor(), *it );
+
+                h.push_back( hash2::get_integral_result<std::uint64_t>( h1 ) );
+            }
+
+            std::sort( h.begin(), h.end() );
+
+            std::vector<std::uint64_t>::iterator p = std::unique( h.begin(), h.end() );
+
+            // equal hash values are either duplicate keys, which are not
+            // allowed, or a 64 bit collision, which a new seed resolves;
+            // if they persist, the duplicates are treated as one key
+
+            if( p == h.end() || attempt == 4 )
+            {
+                h.erase( p, h.end() );
+
+                if( detail::mphf_build( h, seed, gamma, w ) ) break;
+            }
+
+            detail::splitmix64( seed );
+        }
+
+        assign( w.data(), w.size() );
+    }
+
+    minimal_perfect_hash( minimal_perfect_hash const& rhs )
+    {
+        assign( rhs.data(), rhs.byte_size() );
+    }
+
+    minimal_perfect_hash& operator=( minimal_perfect_hash const& rhs )
+    {
+        if( this != &rhs )
+        {
+            assign( rhs.data(), rhs.byte_size() );
+        }
+
+        return *this;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return view_.size();
+    }
+
+    std::size_t operator()( T const& v ) const
+    {
+        return view_( v );
+    }
+
+    // the serialized representation, which minimal_perfect_hash_view
+    // can use in place
+
+    unsigned char const* data() const noexcept
+    {
+        return storage_.data() + offset_;
+    }
+
+    std::size_t byte_size() const noexcept
+    {
+        return n_;
+    }
+
+    void serialize( unsigned char* p ) const noexcept
+    {
+        std::memcpy( p, data(), n_ );
+    }
+
+    bool deserialize( unsigned char const* p, std::size_t n )
+    {
+        minimal_perfect_hash_view<T, Hash, Flavor> v;
+
+        if( !v.attach( p, n ) ) return false;
+
+        assign( p, n );
+
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MINIMAL_PERFECT_HASH_HPP_INCLUDED
@@ -0,0 +1,147 @@
+#ifndef BOOST_HASH2_MULTISET_HASH_HPP_INCLUDED
+#define BOOST_HASH2_MULTISET_HASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Incremental hashing of multisets
+//
+// Dwaine Clarke et al, Incremental Multiset Hash Functions and
+// Their Application to Memory Integrity Checking (MSet-Add-Hash)
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// maintains, under insertions and erasures, the sum of the element
+// hashes and the element count that hash_append_unordered_range( h, f,
+// first, last ) computes for the elements of a multiset, when h is in
+// the state held by the multiset_hash
+
+template<class Hash, class Flavor = default_flavor> class multiset_hash
+{
+private:
+
+    Hash h_;
+
+    std::uint64_t w_ = 0;
+    std::uint64_t n_ = 0;
+
+private:
+
+    template<class T> std::uint64_t element_hash( T const& v ) const
+    {
+        Hash h( h_ );
+        hash2::hash_append( h, Flavor(), v );
+
+        return hash2::get_integral_result<std::uint64_t>( h );
+    }
+
+public:
+
+    multiset_hash() = default;
+
+    explicit multiset_hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    multiset_hash( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    multiset_hash( void const* p, std::size_t n ): multiset_hash( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    // h is the state of the hash algorithm at the point where
+    // the elements would be passed to hash_append_unordered_range
+    explicit multiset_hash( Hash const& h ): h_( h )
+    {
+    }
+
+    void clear() noexcept
+    {
+        w_ = 0;
+        n_ = 0;
+    }
+
+    template<class T> void insert( T const& v )
+    {
+        w_ += element_hash( v );
+        ++n_;
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            insert( *first );
+        }
+    }
+
+    // v must be an element of the multiset
+    template<class T> void erase( T const& v )
+    {
+        BOOST_ASSERT( n_ > 0 );
+
+        w_ -= element_hash( v );
+        --n_;
+    }
+
+    template<class It> void erase( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            erase( *first );
+        }
+    }
+
+    // multiset sum; both objects must hold the same hash algorithm state
+    void merge( multiset_hash const& rhs ) noexcept
+    {
+        w_ += rhs.w_;
+        n_ += rhs.n_;
+    }
+
+    std::uint64_t sum() const noexcept
+    {
+        return w_;
+    }
+
+    std::uint64_t size() const noexcept
+    {
+        return n_;
+    }
+
+    // feeds h what hash_append_unordered_range( h, Flavor(), first, last ) does
+    void append_to( Hash& h ) const
+    {
+        Flavor const f{};
+
+        hash2::hash_append( h, f, w_ );
+        hash2::hash_append_size( h, f, n_ );
+    }
+
+    // the result of the held hash algorithm state, after append_to
+    typename Hash::result_type result() const
+    {
+        Hash h( h_ );
+        append_to( h );
+
+        return h.result();
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MULTISET_HASH_HPP_INCLUDED
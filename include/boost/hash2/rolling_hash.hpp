@@ -0,0 +1,332 @@
+#ifndef BOOST_HASH2_ROLLING_HASH_HPP_INCLUDED
+#define BOOST_HASH2_ROLLING_HASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Rolling hashes (Rabin-Karp, Buzhash, Gear)
+//
+// https://en.wikipedia.org/wiki/Rolling_hash
+
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+inline std::uint64_t rolling_seed( unsigned char const* p, std::size_t n )
+{
+    if( n == 0 ) return 0;
+
+    xxhash_64 h;
+    h.update( p, n );
+
+    return h.result();
+}
+
+class rolling_table
+{
+private:
+
+    std::uint64_t table_[ 256 ] = {};
+
+public:
+
+    BOOST_CXX14_CONSTEXPR explicit rolling_table( std::uint64_t seed )
+    {
+        for( int i = 0; i < 256; ++i )
+        {
+            table_[ i ] = splitmix64( seed );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t operator[]( unsigned char c ) const
+    {
+        return table_[ c ];
+    }
+};
+
+// boundary scanning shared by all rolling hashes; the inner
+// loop is unrolled four times, with a single combined test per
+// four bytes, to keep the branch out of the dependency chain
+
+template<class R, class F> std::size_t rolling_scan( R& r, unsigned char const* p, std::size_t n, std::uint64_t mask, F& f )
+{
+    constexpr std::size_t W = R::window_size;
+
+    r.reset();
+
+    std::size_t i = 0;
+    std::size_t k = 0;
+
+    for( ; i < n && i < W; ++i )
+    {
+        r.push( p[ i ] );
+    }
+
+    if( i == W && ( r.value() & mask ) == 0 )
+    {
+        f( i );
+        ++k;
+    }
+
+    for( ; i + 4 <= n; i += 4 )
+    {
+        r.roll( p[ i + 0 - W ], p[ i + 0 ] ); std::uint64_t h0 = r.value();
+        r.roll( p[ i + 1 - W ], p[ i + 1 ] ); std::uint64_t h1 = r.value();
+        r.roll( p[ i + 2 - W ], p[ i + 2 ] ); std::uint64_t h2 = r.value();
+        r.roll( p[ i + 3 - W ], p[ i + 3 ] ); std::uint64_t h3 = r.value();
+
+        if( ( h0 & mask ) == 0 || ( h1 & mask ) == 0 || ( h2 & mask ) == 0 || ( h3 & mask ) == 0 )
+        {
+            if( ( h0 & mask ) == 0 ) { f( i + 1 ); ++k; }
+            if( ( h1 & mask ) == 0 ) { f( i + 2 ); ++k; }
+            if( ( h2 & mask ) == 0 ) { f( i + 3 ); ++k; }
+            if( ( h3 & mask ) == 0 ) { f( i + 4 ); ++k; }
+        }
+    }
+
+    for( ; i < n; ++i )
+    {
+        r.roll( p[ i - W ], p[ i ] );
+
+        if( ( r.value() & mask ) == 0 )
+        {
+            f( i + 1 );
+            ++k;
+        }
+    }
+
+    return k;
+}
+
+} // namespace detail
+
+// Rabin-Karp polynomial hash over a window of W bytes, modulo 2^64
+
+template<std::size_t W> class rabin_karp_64
+{
+private:
+
+    static_assert( W > 0, "Window size must not be zero" );
+
+    static constexpr std::uint64_t B = 0xD6E8FEB86659FD93ull;
+
+    static BOOST_CXX14_CONSTEXPR std::uint64_t power()
+    {
+        std::uint64_t r = 1;
+
+        for( std::size_t i = 1; i < W; ++i )
+        {
+            r *= B;
+        }
+
+        return r;
+    }
+
+private:
+
+    detail::rolling_table table_;
+    std::uint64_t bw_; // B^(W-1)
+    std::uint64_t h_ = 0;
+
+public:
+
+    using result_type = std::uint64_t;
+    static constexpr std::size_t window_size = W;
+
+    BOOST_CXX14_CONSTEXPR rabin_karp_64(): table_( 0 ), bw_( power() )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit rabin_karp_64( std::uint64_t seed ): table_( seed ), bw_( power() )
+    {
+    }
+
+    rabin_karp_64( unsigned char const* p, std::size_t n ): rabin_karp_64( detail::rolling_seed( p, n ) )
+    {
+    }
+
+    rabin_karp_64( void const* p, std::size_t n ): rabin_karp_64( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR void reset()
+    {
+        h_ = 0;
+    }
+
+    BOOST_CXX14_CONSTEXPR void push( unsigned char in )
+    {
+        h_ = h_ * B + table_[ in ];
+    }
+
+    BOOST_CXX14_CONSTEXPR void roll( unsigned char out, unsigned char in )
+    {
+        h_ = ( h_ - table_[ out ] * bw_ ) * B + table_[ in ];
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type value() const
+    {
+        return h_;
+    }
+
+    template<class F> std::size_t scan( unsigned char const* p, std::size_t n, std::uint64_t mask, F f )
+    {
+        return detail::rolling_scan( *this, p, n, mask, f );
+    }
+
+    template<class F> std::size_t scan( void const* p, std::size_t n, std::uint64_t mask, F f )
+    {
+        return scan( static_cast<unsigned char const*>( p ), n, mask, f );
+    }
+};
+
+// Buzhash (cyclic polynomial) over a window of W bytes
+
+template<std::size_t W> class buzhash_64
+{
+private:
+
+    static_assert( W > 0, "Window size must not be zero" );
+
+private:
+
+    detail::rolling_table table_;
+    std::uint64_t h_ = 0;
+
+public:
+
+    using result_type = std::uint64_t;
+    static constexpr std::size_t window_size = W;
+
+    BOOST_CXX14_CONSTEXPR buzhash_64(): table_( 0 )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit buzhash_64( std::uint64_t seed ): table_( seed )
+    {
+    }
+
+    buzhash_64( unsigned char const* p, std::size_t n ): buzhash_64( detail::rolling_seed( p, n ) )
+    {
+    }
+
+    buzhash_64( void const* p, std::size_t n ): buzhash_64( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR void reset()
+    {
+        h_ = 0;
+    }
+
+    BOOST_CXX14_CONSTEXPR void push( unsigned char in )
+    {
+        h_ = detail::rotl( h_, 1 ) ^ table_[ in ];
+    }
+
+    BOOST_CXX14_CONSTEXPR void roll( unsigned char out, unsigned char in )
+    {
+        std::uint64_t t = table_[ out ];
+
+        // detail::rotl requires a nonzero shift; a rotation by 64 is a no-op
+        if( W % 64 != 0 )
+        {
+            t = detail::rotl( t, W % 64 );
+        }
+
+        h_ = detail::rotl( h_, 1 ) ^ t ^ table_[ in ];
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type value() const
+    {
+        return h_;
+    }
+
+    template<class F> std::size_t scan( unsigned char const* p, std::size_t n, std::uint64_t mask, F f )
+    {
+        return detail::rolling_scan( *this, p, n, mask, f );
+    }
+
+    template<class F> std::size_t scan( void const* p, std::size_t n, std::uint64_t mask, F f )
+    {
+        return scan( static_cast<unsigned char const*>( p ), n, mask, f );
+    }
+};
+
+// Gear hash; the window is implicitly 64 bytes, as older bytes are shifted out
+
+class gear_64
+{
+private:
+
+    detail::rolling_table table_;
+    std::uint64_t h_ = 0;
+
+public:
+
+    using result_type = std::uint64_t;
+    static constexpr std::size_t window_size = 64;
+
+    BOOST_CXX14_CONSTEXPR gear_64(): table_( 0 )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit gear_64( std::uint64_t seed ): table_( seed )
+    {
+    }
+
+    gear_64( unsigned char const* p, std::size_t n ): gear_64( detail::rolling_seed( p, n ) )
+    {
+    }
+
+    gear_64( void const* p, std::size_t n ): gear_64( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR void reset()
+    {
+        h_ = 0;
+    }
+
+    BOOST_CXX14_CONSTEXPR void push( unsigned char in )
+    {
+        h_ = ( h_ << 1 ) + table_[ in ];
+    }
+
+    BOOST_CXX14_CONSTEXPR void roll( unsigned char /*out*/, unsigned char in )
+    {
+        h_ = ( h_ << 1 ) + table_[ in ];
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type value() const
+    {
+        return h_;
+    }
+
+    template<class F> std::size_t scan( unsigned char const* p, std::size_t n, std::uint64_t mask, F f )
+    {
+        return detail::rolling_scan( *this, p, n, mask, f );
+    }
+
+    template<class F> std::size_t scan( void const* p, std::size_t n, std::uint64_t mask, F f )
+    {
+        return scan( static_cast<unsigned char const*>( p ), n, mask, f );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ROLLING_HASH_HPP_INCLUDED
@@ -29,6 +29,8 @@ namespace hash2
 namespace detail
 {
 
+template<class H> struct hash_bytes_impl;
+
 template<class Word, class Algo, int M>
 struct sha2_base
 {
@@ -583,6 +585,10 @@ public:
 
         return digest;
     }
+
+private:
+
+    friend struct detail::hash_bytes_impl<sha2_256>;
 };
 
 class sha2_224 : detail::sha2_256_base
@@ -0,0 +1,123 @@
+#ifndef BOOST_HASH2_SIMHASH_HPP_INCLUDED
+#define BOOST_HASH2_SIMHASH_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SimHash
+//
+// Moses S. Charikar, Similarity estimation techniques from rounding algorithms
+
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/sketch_hasher.hpp>
+#include <boost/hash2/detail/popcount.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class T, class Hash, class Flavor = default_flavor> class simhash: private detail::sketch_hasher<T, Hash, Flavor>
+{
+private:
+
+    using base = detail::sketch_hasher<T, Hash, Flavor>;
+
+    std::int64_t w_[ 64 ] = {};
+
+private:
+
+    // written without branches, so that compilers vectorize it
+    void insert_hash( std::uint64_t x, std::int64_t weight ) noexcept
+    {
+        for( int i = 0; i < 64; ++i )
+        {
+            std::int64_t b = static_cast<std::int64_t>( ( x >> i ) & 1 );
+            w_[ i ] += ( 2 * b - 1 ) * weight;
+        }
+    }
+
+public:
+
+    simhash() = default;
+
+    explicit simhash( std::uint64_t seed ): base( seed )
+    {
+    }
+
+    simhash( unsigned char const* p, std::size_t n ): base( p, n )
+    {
+    }
+
+    simhash( void const* p, std::size_t n ): simhash( static_cast<unsigned char const*>( p ), n )
+    {
+    }
+
+    void clear() noexcept
+    {
+        for( int i = 0; i < 64; ++i )
+        {
+            w_[ i ] = 0;
+        }
+    }
+
+    void insert( T const& v )
+    {
+        insert_hash( base::hash_value( v ), 1 );
+    }
+
+    void insert_weighted( T const& v, std::int64_t weight )
+    {
+        insert_hash( base::hash_value( v ), weight );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            insert_hash( base::hash_value( *first ), 1 );
+        }
+    }
+
+    template<class It> void insert_shingles( It first, It last, std::size_t w )
+    {
+        BOOST_ASSERT( w > 0 );
+
+        base::for_each_shingle( first, last, w, [this]( std::uint64_t x ){ insert_hash( x, 1 ); } );
+    }
+
+    // both sketches must have the same seed
+    void merge( simhash const& rhs ) noexcept
+    {
+        for( int i = 0; i < 64; ++i )
+        {
+            w_[ i ] += rhs.w_[ i ];
+        }
+    }
+
+    std::uint64_t value() const noexcept
+    {
+        std::uint64_t r = 0;
+
+        for( int i = 0; i < 64; ++i )
+        {
+            r |= static_cast<std::uint64_t>( w_[ i ] > 0 ) << i;
+        }
+
+        return r;
+    }
+
+    int hamming_distance( simhash const& rhs ) const noexcept
+    {
+        return detail::popcount( value() ^ rhs.value() );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SIMHASH_HPP_INCLUDED
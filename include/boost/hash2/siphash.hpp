@@ -8,6 +8,7 @@
 // SipHash, https://131002.net/siphash/
 
 #include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
 #include <boost/hash2/detail/memset.hpp>
@@ -22,6 +23,14 @@ namespace boost
 namespace hash2
 {
 
+namespace detail
+{
+
+template<class H> struct hash_bytes_impl;
+struct siphash_batch_kernel;
+
+} // namespace detail
+
 class siphash_64
 {
 private:
@@ -58,8 +67,11 @@ private:
 
     BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p )
     {
-        std::uint64_t m = detail::read64le( p );
+        update_( detail::read64le( p ) );
+    }
 
+    BOOST_CXX14_CONSTEXPR void update_( std::uint64_t m )
+    {
         v3 ^= m;
 
         sipround();
@@ -68,6 +80,22 @@ private:
         v0 ^= m;
     }
 
+    // m holds the final bytes and the length in its top byte
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t finalize_( std::uint64_t m )
+    {
+        update_( m );
+
+        v2 ^= 0xFF;
+
+        sipround();
+        sipround();
+        sipround();
+        sipround();
+
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+
 public:
 
     using result_type = std::uint64_t;
@@ -164,6 +192,54 @@ public:
         update( p, n );
     }
 
+    // equivalent to update() with the bytes of w in little endian order;
+    // the word is combined with the buffered bytes in a register
+
+    BOOST_CXX14_CONSTEXPR void update_u32( std::uint32_t w )
+    {
+        BOOST_ASSERT( m_ == n_ % 8 );
+
+        std::uint64_t const lo = detail::read64le( buffer_ ) & ( ( std::uint64_t( 1 ) << ( 8 * m_ ) ) - 1 );
+        std::uint64_t const m = lo | static_cast<std::uint64_t>( w ) << ( 8 * m_ );
+
+        if( m_ + 4 < 8 )
+        {
+            detail::write64le( buffer_, m );
+            m_ += 4;
+        }
+        else
+        {
+            update_( m );
+
+            // the bytes of w that don't fit; also clears buffered plaintext
+            detail::write64le( buffer_, static_cast<std::uint64_t>( w ) >> ( 64 - 8 * m_ ) );
+            m_ -= 4;
+        }
+
+        n_ += 4;
+    }
+
+    BOOST_CXX14_CONSTEXPR void update_u64( std::uint64_t w )
+    {
+        BOOST_ASSERT( m_ == n_ % 8 );
+
+        if( m_ == 0 )
+        {
+            update_( w );
+        }
+        else
+        {
+            std::uint64_t const lo = detail::read64le( buffer_ ) & ( ( std::uint64_t( 1 ) << ( 8 * m_ ) ) - 1 );
+
+            update_( lo | w << ( 8 * m_ ) );
+
+            // the bytes of w that don't fit; also clears buffered plaintext
+            detail::write64le( buffer_, w >> ( 64 - 8 * m_ ) );
+        }
+
+        n_ += 8;
+    }
+
     BOOST_CXX14_CONSTEXPR std::uint64_t result()
     {
         BOOST_ASSERT( m_ == n_ % 8 );
@@ -172,14 +248,7 @@ public:
 
         buffer_[ 7 ] = static_cast<unsigned char>( n_ & 0xFF );
 
-        update_( buffer_ );
-
-        v2 ^= 0xFF;
-
-        sipround();
-        sipround();
-        sipround();
-        sipround();
+        std::uint64_t const m = detail::read64le( buffer_ );
 
         n_ += 8 - m_;
         m_ = 0;
@@ -187,8 +256,13 @@ public:
         // clear buffered plaintext
         detail::memset( buffer_, 0, 8 );
 
-        return v0 ^ v1 ^ v2 ^ v3;
+        return finalize_( m );
     }
+
+private:
+
+    friend struct detail::hash_bytes_impl<siphash_64>;
+    friend struct detail::siphash_batch_kernel;
 };
 
 class siphash_32
@@ -0,0 +1,293 @@
+#ifndef BOOST_HASH2_STATIC_MAP_HPP_INCLUDED
+#define BOOST_HASH2_STATIC_MAP_HPP_INCLUDED
+
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// A constexpr perfect hash map over a fixed set of keys
+//
+// Fabiano C. Botelho, Djamal Belazzougui, Martin Dietzfelbinger,
+// Hash, displace, and compress
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the smallest power of two not less than n
+constexpr std::size_t static_map_table_size( std::size_t n, std::size_t m = 1 )
+{
+    return m >= n? m: static_map_table_size( n, m * 2 );
+}
+
+// the number of displacements tried for a bucket before
+// the construction attempt is abandoned
+constexpr std::uint32_t static_map_max_displacement = 1u << 16;
+
+} // namespace detail
+
+template<class Key, class Value, std::size_t N, class Hash = fnv1a_64, class Flavor = default_flavor> class static_map
+{
+private:
+
+    static_assert( N > 0, "N must be positive" );
+
+public:
+
+    using key_type = Key;
+    using mapped_type = Value;
+
+    static constexpr std::size_t table_size = detail::static_map_table_size( N );
+
+private:
+
+    static constexpr std::size_t mask = table_size - 1;
+
+    std::uint64_t seed_ = 0;
+    std::size_t size_ = 0;
+
+    // per bucket displacement
+    std::uint32_t disp_[ table_size ] = {};
+
+    // the slots
+    bool used_[ table_size ] = {};
+    Key keys_[ table_size ] = {};
+    Value values_[ table_size ] = {};
+
+private:
+
+    static BOOST_CXX14_CONSTEXPR std::uint64_t hash_key( Key const& k, std::uint64_t seed )
+    {
+        Hash h( seed );
+        hash_append( h, Flavor(), k );
+
+        return get_integral_result<std::uint64_t>( h );
+    }
+
+    // the bucket is selected by the high bits of the hash value; the slot
+    // is obtained by mixing the hash value with the bucket displacement
+
+    static BOOST_CXX14_CONSTEXPR std::size_t bucket( std::uint64_t h ) noexcept
+    {
+        return static_cast<std::size_t>( h >> 32 ) & mask;
+    }
+
+    static BOOST_CXX14_CONSTEXPR std::size_t slot( std::uint64_t h, std::uint32_t d ) noexcept
+    {
+        return static_cast<std::size_t>( detail::splitmix64_mix( h + d * 0x9E3779B97F4A7C15ull ) ) & mask;
+    }
+
+    // one construction attempt; fails when two different keys have the same
+    // hash value, or when no displacement places a bucket in free slots
+
+    BOOST_CXX14_CONSTEXPR bool build( std::pair<Key, Value> const (&a)[ N ], std::uint64_t seed )
+    {
+        seed_ = seed;
+        size_ = 0;
+
+        for( std::size_t i = 0; i < table_size; ++i )
+        {
+            disp_[ i ] = 0;
+            used_[ i ] = false;
+        }
+
+        std::uint64_t h[ N ] = {};
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            h[ i ] = hash_key( a[ i ].first, seed );
+        }
+
+        // group the keys by bucket; first[ b ] .. first[ b + 1 ] are the
+        // positions of the keys in bucket b in members
+
+        std::size_t first[ table_size + 1 ] = {};
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            ++first[ bucket( h[ i ] ) + 1 ];
+        }
+
+        std::size_t max_size = 0;
+
+        for( std::size_t b = 0; b < table_size; ++b )
+        {
+            if( first[ b + 1 ] > max_size ) max_size = first[ b + 1 ];
+            first[ b + 1 ] += first[ b ];
+        }
+
+        std::size_t members[ N ] = {};
+        std::size_t next[ table_size ] = {};
+
+        for( std::size_t b = 0; b < table_size; ++b )
+        {
+            next[ b ] = first[ b ];
+        }
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            members[ next[ bucket( h[ i ] ) ]++ ] = i;
+        }
+
+        // of two equal keys, the first one is kept, as in std::map
+
+        bool skip[ N ] = {};
+
+        for( std::size_t b = 0; b < table_size; ++b )
+        {
+            for( std::size_t j = first[ b ]; j < first[ b + 1 ]; ++j )
+            {
+                for( std::size_t k = first[ b ]; k < j; ++k )
+                {
+                    std::size_t i1 = members[ k ], i2 = members[ j ];
+
+                    if( skip[ i1 ] || h[ i1 ] != h[ i2 ] ) continue;
+                    if( !( a[ i1 ].first == a[ i2 ].first ) ) return false;
+
+                    skip[ i2 ] = true;
+                }
+            }
+        }
+
+        // place the buckets, the largest first
+
+        for( std::size_t s = max_size; s > 0; --s )
+        {
+            for( std::size_t b = 0; b < table_size; ++b )
+            {
+                if( first[ b + 1 ] - first[ b ] != s ) continue;
+
+                std::uint32_t d = 0;
+
+                for( ; d < detail::static_map_max_displacement; ++d )
+                {
+                    bool ok = true;
+
+                    for( std::size_t j = first[ b ]; ok && j < first[ b + 1 ]; ++j )
+                    {
+                        if( skip[ members[ j ] ] ) continue;
+
+                        std::size_t q = slot( h[ members[ j ] ], d );
+
+                        if( used_[ q ] )
+                        {
+                            ok = false;
+                            break;
+                        }
+
+                        for( std::size_t k = first[ b ]; k < j; ++k )
+                        {
+                            if( !skip[ members[ k ] ] && slot( h[ members[ k ] ], d ) == q )
+                            {
+                                ok = false;
+                                break;
+                            }
+                        }
+                    }
+
+                    if( ok ) break;
+                }
+
+                if( d == detail::static_map_max_displacement ) return false;
+
+                disp_[ b ] = d;
+
+                for( std::size_t j = first[ b ]; j < first[ b + 1 ]; ++j )
+                {
+                    std::size_t i = members[ j ];
+
+                    if( skip[ i ] ) continue;
+
+                    std::size_t q = slot( h[ i ], d );
+
+                    used_[ q ] = true;
+                    keys_[ q ] = a[ i ].first;
+                    values_[ q ] = a[ i ].second;
+
+                    ++size_;
+                }
+            }
+        }
+
+        return true;
+    }
+
+public:
+
+    // the search for a working seed starts from seed; Key and Value must
+    // be default constructible and copy assignable (in constexpr, when the
+    // map is constructed at compile time)
+
+    explicit BOOST_CXX14_CONSTEXPR static_map( std::pair<Key, Value> const (&a)[ N ], std::uint64_t seed = 0 )
+    {
+        while( !build( a, seed ) )
+        {
+            detail::splitmix64( seed );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t seed() const noexcept
+    {
+        return seed_;
+    }
+
+    BOOST_CXX14_CONSTEXPR std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    // one hash computation and one slot probe
+
+    BOOST_CXX14_CONSTEXPR Value const* find( Key const& k ) const
+    {
+        std::uint64_t h = hash_key( k, seed_ );
+        std::size_t q = slot( h, disp_[ bucket( h ) ] );
+
+        return used_[ q ] && keys_[ q ] == k? &values_[ q ]: nullptr;
+    }
+
+    BOOST_CXX14_CONSTEXPR bool contains( Key const& k ) const
+    {
+        return find( k ) != nullptr;
+    }
+
+    BOOST_CXX14_CONSTEXPR Value value_or( Key const& k, Value const& v ) const
+    {
+        Value const* p = find( k );
+        return p? *p: v;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class Key, class Value, std::size_t N, class Hash, class Flavor>
+constexpr std::size_t static_map<Key, Value, N, Hash, Flavor>::table_size;
+
+#endif
+
+// make_static_map<Key, Value>( { { k1, v1 }, { k2, v2 }, ... } )
+
+template<class Key, class Value, class Hash = fnv1a_64, class Flavor = default_flavor, std::size_t N>
+BOOST_CXX14_CONSTEXPR static_map<Key, Value, N, Hash, Flavor> make_static_map( std::pair<Key, Value> const (&a)[ N ], std::uint64_t seed = 0 )
+{
+    return static_map<Key, Value, N, Hash, Flavor>( a, seed );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_STATIC_MAP_HPP_INCLUDED
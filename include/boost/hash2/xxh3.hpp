@@ -33,6 +33,13 @@ namespace boost
 namespace hash2
 {
 
+namespace detail
+{
+
+template<class H> struct hash_bytes_impl;
+
+} // namespace detail
+
 template<class = void>
 struct xxh3_128_constants
 {
@@ -66,9 +73,15 @@ constexpr unsigned char xxh3_128_constants<T>::default_secret[ 192 ];
 
 #endif
 
-class xxh3_128
+namespace detail
 {
-private:
+
+// the XXH3-128 algorithm; D::secret_data_() returns the secret, which
+// xxh3_128 holds and xxh3_128_shared refers to
+
+template<class D> class xxh3_128_base
+{
+protected:
 
     static constexpr std::size_t const default_secret_len = 192;
     static constexpr std::size_t const min_secret_len     = 136;
@@ -85,19 +98,15 @@ private:
     static constexpr std::uint64_t const PRIME_MX1 = 0x165667919E3779F9ULL;
     static constexpr std::uint64_t const PRIME_MX2 = 0x9FB21C651E98DF25ULL;
 
-    BOOST_CXX14_CONSTEXPR void init_secret_from_seed( std::uint64_t seed )
+    BOOST_CXX14_CONSTEXPR unsigned char const* secret_data() const
     {
-        auto const secret = xxh3_128_constants<>::default_secret;
-
-        std::size_t num_rounds = default_secret_len / 16;
-        for( std::size_t i = 0; i < num_rounds; ++i )
-        {
-            auto low  = detail::read64le( secret + 16 * i ) + seed;
-            auto high = detail::read64le( secret + 16 * i + 8 ) - seed;
+        return static_cast<D const*>( this )->secret_data_();
+    }
 
-            detail::write64le( secret_ + 16 * i, low );
-            detail::write64le( secret_ + 16 * i + 8, high );
-        }
+    // the secret used for inputs of up to 240 bytes
+    BOOST_CXX14_CONSTEXPR unsigned char const* short_secret() const
+    {
+        return with_secret_? secret_data(): xxh3_128_constants<>::default_secret;
     }
 
     BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t avalanche( std::uint64_t x )
@@ -118,10 +127,8 @@ private:
         return x;
     }
 
-    BOOST_CXX14_CONSTEXPR std::uint64_t mix_step( unsigned char const* data, std::size_t secret_offset, std::uint64_t seed )
+    BOOST_CXX14_CONSTEXPR static std::uint64_t mix_step( unsigned char const* secret, unsigned char const* data, std::size_t secret_offset, std::uint64_t seed )
     {
-        auto const secret = with_secret_? secret_: xxh3_128_constants<>::default_secret;
-
         std::uint64_t data_words[ 2 ] = {};
         std::uint64_t secret_words[ 2 ] = {};
         for( int i = 0; i < 2; ++i )
@@ -134,7 +141,7 @@ private:
         return r.low ^ r.high;
     }
 
-    BOOST_CXX14_CONSTEXPR void mix_two_chunks( unsigned char const* x, unsigned char const* y, std::size_t secret_offset, std::uint64_t seed, std::uint64_t (&acc)[ 2 ] )
+    BOOST_CXX14_CONSTEXPR static void mix_two_chunks( unsigned char const* secret, unsigned char const* x, unsigned char const* y, std::size_t secret_offset, std::uint64_t seed, std::uint64_t (&acc)[ 2 ] )
     {
         std::uint64_t data_words1[ 2 ] = {};
         std::uint64_t data_words2[ 2 ] = {};
@@ -145,8 +152,8 @@ private:
             data_words2[ i ] = detail::read64le( y + 8 * i );
         }
 
-        acc[ 0 ] += mix_step( x, secret_offset, seed );
-        acc[ 1 ] += mix_step( y, secret_offset + 16, seed );
+        acc[ 0 ] += mix_step( secret, x, secret_offset, seed );
+        acc[ 1 ] += mix_step( secret, y, secret_offset + 16, seed );
         acc[ 0 ] ^= ( data_words2[ 0 ] + data_words2[ 1 ] );
         acc[ 1 ] ^= ( data_words1[ 0 ] + data_words1[ 1 ] );
     }
@@ -156,7 +163,7 @@ private:
         std::uint64_t secret_words[ 8 ] = {};
         for( int i = 0; i < 8; ++i )
         {
-            secret_words[ i ] = detail::read64le( secret_ + secret_offset + 8 * i );
+            secret_words[ i ] = detail::read64le( secret_data() + secret_offset + 8 * i );
         }
 
         for( int i = 0; i < 8; ++i )
@@ -172,7 +179,7 @@ private:
         std::uint64_t secret_words[ 8 ] = {};
         for( int i = 0; i < 8; ++i )
         {
-            secret_words[ i ] = detail::read64le( secret_ + ( secret_len_ - 64 ) + ( 8 * i ) );
+            secret_words[ i ] = detail::read64le( secret_data() + ( secret_len_ - 64 ) + ( 8 * i ) );
         }
 
         for( int i = 0; i < 8; ++i )
@@ -232,7 +239,7 @@ private:
         std::uint64_t secret_words[ 8 ] = {};
         for( int i = 0; i < 8; ++i )
         {
-            secret_words[ i ] = detail::read64le( secret_ + secret_offset + 8 * i );
+            secret_words[ i ] = detail::read64le( secret_data() + secret_offset + 8 * i );
         }
 
         std::uint64_t result = init_value;
@@ -245,10 +252,8 @@ private:
         return avalanche( result );
     }
 
-    BOOST_CXX14_CONSTEXPR digest<16> xxh3_128_digest_empty()
+    BOOST_CXX14_CONSTEXPR static digest<16> xxh3_128_digest_empty( unsigned char const* secret, std::uint64_t seed )
     {
-        auto const secret = with_secret_? secret_: xxh3_128_constants<>::default_secret;
-
         std::uint64_t secret_words[ 4 ] = {};
         for( int i = 0; i < 4; ++i )
         {
@@ -256,19 +261,17 @@ private:
         }
 
         digest<16> r;
-        detail::write64be( r.data() + 8, avalanche_xxh64( seed_ ^ secret_words[ 0 ] ^ secret_words[ 1 ] ) );
-        detail::write64be( r.data() + 0, avalanche_xxh64( seed_ ^ secret_words[ 2 ] ^ secret_words[ 3 ] ) );
+        detail::write64be( r.data() + 8, avalanche_xxh64( seed ^ secret_words[ 0 ] ^ secret_words[ 1 ] ) );
+        detail::write64be( r.data() + 0, avalanche_xxh64( seed ^ secret_words[ 2 ] ^ secret_words[ 3 ] ) );
         return r;
     }
 
-    BOOST_CXX14_CONSTEXPR digest<16> xxh3_128_digest_1to3()
+    BOOST_CXX14_CONSTEXPR static digest<16> xxh3_128_digest_1to3( unsigned char const* secret, std::uint64_t seed, unsigned char const* p, std::size_t n )
     {
-        auto const secret = with_secret_? secret_: xxh3_128_constants<>::default_secret;
-
-        std::uint32_t v1 = buffer_[ ( n_ - 1 ) ];
-        std::uint32_t v2 = static_cast<std::uint32_t>( n_ << 8 );
-        std::uint32_t v3 = buffer_[ 0 ] << 16;
-        std::uint32_t v4 = buffer_[ ( n_ >> 1 ) ] << 24;
+        std::uint32_t v1 = p[ ( n - 1 ) ];
+        std::uint32_t v2 = static_cast<std::uint32_t>( n << 8 );
+        std::uint32_t v3 = p[ 0 ] << 16;
+        std::uint32_t v4 = p[ ( n >> 1 ) ] << 24;
 
         std::uint32_t combined = v1 | v2 | v3 | v4;
 
@@ -278,8 +281,8 @@ private:
             secret_words[ i ] = detail::read32le( secret + 4 * i );
         }
 
-        std::uint64_t low  = ( ( secret_words[ 0 ] ^ secret_words[ 1 ] ) + seed_ ) ^ combined;
-        std::uint64_t high = ( ( secret_words[ 2 ] ^ secret_words[ 3 ] ) - seed_ ) ^ ( detail::rotl( detail::byteswap( combined ), 13 ) );
+        std::uint64_t low  = ( ( secret_words[ 0 ] ^ secret_words[ 1 ] ) + seed ) ^ combined;
+        std::uint64_t high = ( ( secret_words[ 2 ] ^ secret_words[ 3 ] ) - seed ) ^ ( detail::rotl( detail::byteswap( combined ), 13 ) );
 
         digest<16> r;
         detail::write64be( r.data() + 8, avalanche_xxh64( low ) );
@@ -288,13 +291,11 @@ private:
         return r;
     }
 
-    BOOST_CXX14_CONSTEXPR digest<16> xxh3_128_digest_4to8()
+    BOOST_CXX14_CONSTEXPR static digest<16> xxh3_128_digest_4to8( unsigned char const* secret, std::uint64_t seed, unsigned char const* p, std::size_t n )
     {
-        auto const secret = with_secret_? secret_: xxh3_128_constants<>::default_secret;
-
-        std::uint32_t input_first = detail::read32le( buffer_ );
-        std::uint32_t input_last  = detail::read32le( buffer_ + ( n_ - 4 ) );
-        std::uint64_t modified_seed = seed_ ^ ( std::uint64_t{ detail::byteswap( static_cast<std::uint32_t>( seed_ ) ) } << 32 );
+        std::uint32_t input_first = detail::read32le( p );
+        std::uint32_t input_last  = detail::read32le( p + ( n - 4 ) );
+        std::uint64_t modified_seed = seed ^ ( std::uint64_t{ detail::byteswap( static_cast<std::uint32_t>( seed ) ) } << 32 );
 
         std::uint64_t secret_words[ 2 ] = {};
         for( int i = 0; i < 2; ++i )
@@ -305,7 +306,7 @@ private:
         std::uint64_t combined = std::uint64_t{ input_first } | ( std::uint64_t{ input_last } << 32 );
         std::uint64_t value = ( ( secret_words[ 0 ] ^ secret_words[ 1 ] ) + modified_seed ) ^ combined;
 
-        detail::uint128 mul_result = detail::mul128( value, P64_1 + ( n_ << 2 ) );
+        detail::uint128 mul_result = detail::mul128( value, P64_1 + ( n << 2 ) );
         std::uint64_t high = mul_result.high;
         std::uint64_t low = mul_result.low;
 
@@ -324,12 +325,10 @@ private:
         return r;
     }
 
-    BOOST_CXX14_CONSTEXPR digest<16> xxh3_128_digest_9to16()
+    BOOST_CXX14_CONSTEXPR static digest<16> xxh3_128_digest_9to16( unsigned char const* secret, std::uint64_t seed, unsigned char const* p, std::size_t n )
     {
-        auto const secret = with_secret_? secret_: xxh3_128_constants<>::default_secret;
-
-        std::uint64_t input_first = detail::read64le( buffer_ );
-        std::uint64_t input_last = detail::read64le( buffer_ + ( n_ - 8 ) );
+        std::uint64_t input_first = detail::read64le( p );
+        std::uint64_t input_last = detail::read64le( p + ( n - 8 ) );
 
         std::uint64_t secret_words[ 4 ] = {};
         for( int i = 0; i < 4; ++i )
@@ -337,11 +336,11 @@ private:
             secret_words[ i ] = detail::read64le( secret + 32 + ( i * 8 ) );
         }
 
-        std::uint64_t val1 = ( ( secret_words[ 0 ] ^ secret_words[ 1 ] ) - seed_ ) ^ input_first ^ input_last;
-        std::uint64_t val2 = ( ( secret_words[ 2 ] ^ secret_words[ 3 ] ) + seed_ ) ^ input_last;
+        std::uint64_t val1 = ( ( secret_words[ 0 ] ^ secret_words[ 1 ] ) - seed ) ^ input_first ^ input_last;
+        std::uint64_t val2 = ( ( secret_words[ 2 ] ^ secret_words[ 3 ] ) + seed ) ^ input_last;
 
         detail::uint128 mul_result = detail::mul128( val1, P64_1 );
-        std::uint64_t low = mul_result.low + ( std::uint64_t{ n_ - 1 } << 54 );
+        std::uint64_t low = mul_result.low + ( std::uint64_t{ n - 1 } << 54 );
         std::uint64_t high = mul_result.high + val2 + ( val2 & 0x00000000ffffffff ) * ( P32_2 - 1 );
 
         low ^= detail::byteswap( high );
@@ -357,21 +356,21 @@ private:
         return r;
     }
 
-    BOOST_CXX14_CONSTEXPR digest<16> xxh3_128_digest_17to128()
+    BOOST_CXX14_CONSTEXPR static digest<16> xxh3_128_digest_17to128( unsigned char const* secret, std::uint64_t seed, unsigned char const* p, std::size_t n )
     {
-        std::uint64_t acc[ 2 ] = { n_ * P64_1, 0 };
+        std::uint64_t acc[ 2 ] = { n * P64_1, 0 };
 
-        std::uint64_t num_rounds = ( ( n_ - 1 ) >> 5 ) + 1;
+        std::uint64_t num_rounds = ( ( n - 1 ) >> 5 ) + 1;
         for( std::int64_t i = num_rounds - 1; i >= 0; --i )
         {
             std::size_t offset_start = static_cast<std::size_t>( 16 * i );
-            std::size_t offset_end = n_ - static_cast<std::size_t>( 16 * i ) - 16;
+            std::size_t offset_end = n - static_cast<std::size_t>( 16 * i ) - 16;
 
-            mix_two_chunks( buffer_ + offset_start, buffer_ + offset_end, static_cast<std::size_t>( 32 * i ), seed_, acc );
+            mix_two_chunks( secret, p + offset_start, p + offset_end, static_cast<std::size_t>( 32 * i ), seed, acc );
         }
 
         std::uint64_t low = acc[ 0 ] + acc[ 1 ];
-        std::uint64_t high = ( acc[ 0 ] * P64_1 ) + ( acc[ 1 ] * P64_4 ) + ( ( std::uint64_t{ n_ } - seed_ ) * P64_2 );
+        std::uint64_t high = ( acc[ 0 ] * P64_1 ) + ( acc[ 1 ] * P64_4 ) + ( ( std::uint64_t{ n } - seed ) * P64_2 );
 
         digest<16> r;
         detail::write64be( r.data() + 0, std::uint64_t{ 0 } - avalanche( high ) );
@@ -380,15 +379,15 @@ private:
         return r;
     }
 
-    BOOST_CXX14_CONSTEXPR digest<16> xxh3_128_digest_129to240()
+    BOOST_CXX14_CONSTEXPR static digest<16> xxh3_128_digest_129to240( unsigned char const* secret, std::uint64_t seed, unsigned char const* p, std::size_t n )
     {
-        std::uint64_t acc[ 2 ] = { n_ * P64_1, 0 };
+        std::uint64_t acc[ 2 ] = { n * P64_1, 0 };
 
-        std::uint64_t num_chunks = n_ >> 5;
+        std::uint64_t num_chunks = n >> 5;
 
         for( std::size_t i = 0; i < 4; ++i )
         {
-            mix_two_chunks( buffer_ + 32 * i, buffer_ + ( 32 * i ) + 16, 32 * i, seed_, acc );
+            mix_two_chunks( secret, p + 32 * i, p + ( 32 * i ) + 16, 32 * i, seed, acc );
         }
 
         acc[ 0 ] = avalanche( acc[ 0 ] );
@@ -396,13 +395,13 @@ private:
 
         for( std::size_t i = 4; i < num_chunks; ++i )
         {
-            mix_two_chunks( buffer_ + 32 * i, buffer_ + ( 32 * i ) + 16, ( i - 4 ) * 32 + 3, seed_, acc );
+            mix_two_chunks( secret, p + 32 * i, p + ( 32 * i ) + 16, ( i - 4 ) * 32 + 3, seed, acc );
         }
 
-        mix_two_chunks( buffer_ + n_ - 16, buffer_ + n_ - 32, 103, std::uint64_t{ 0 } - seed_, acc );
+        mix_two_chunks( secret, p + n - 16, p + n - 32, 103, std::uint64_t{ 0 } - seed, acc );
 
         std::uint64_t low = acc[ 0 ] + acc[ 1 ];
-        std::uint64_t high = ( acc[ 0 ] * P64_1 ) + ( acc[ 1 ] * P64_4 ) + ( ( std::uint64_t{ n_ } - seed_ ) * P64_2 );
+        std::uint64_t high = ( acc[ 0 ] * P64_1 ) + ( acc[ 1 ] * P64_4 ) + ( ( std::uint64_t{ n } - seed ) * P64_2 );
 
         digest<16> r;
         detail::write64be( r.data() + 0, std::uint64_t{ 0 } - avalanche( high ) );
@@ -430,9 +429,8 @@ private:
         return avalanche( v1 + v2 );
     }
 
-private:
+protected:
 
-    unsigned char secret_[ default_secret_len ] = {};
     std::uint64_t seed_ = 0;
     bool with_secret_ = false;
 
@@ -447,16 +445,204 @@ private:
 
     std::size_t num_stripes_ = 0; // current number of processed stripes
 
+protected:
+
+    xxh3_128_base() = default;
+
+    BOOST_CXX14_CONSTEXPR xxh3_128_base( std::uint64_t seed, bool with_secret, std::size_t secret_len ): seed_( seed ), with_secret_( with_secret ), secret_len_( secret_len )
+    {
+    }
+
 public:
 
     using result_type = digest<16>;
 
+    void update( void const* p, std::size_t n )
+    {
+        update( static_cast<unsigned char const*>( p ), n );
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        if( n == 0 ) return;
+
+        std::size_t const stripes_per_block_ = ( secret_len_ - 64 ) / 8;
+
+        n_ += n;
+
+        if( n <= buffer_size - m_ )
+        {
+            detail::memcpy( buffer_ + m_, p, n );
+            m_ += n;
+            return;
+        }
+
+        if( m_ > 0 )
+        {
+            std::size_t k = buffer_size - m_;
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            for( std::size_t i = 0; i < 4; ++i )
+            {
+                std::uint64_t stripe[ 8 ] = {};
+                for( int j = 0; j < 8; ++j )
+                {
+                    stripe[ j ] = detail::read64le( buffer_ + ( 64 * i)  + ( 8 * j ) );
+                }
+                accumulate( stripe, 8 * num_stripes_ );
+                ++num_stripes_;
+
+                if( num_stripes_ == stripes_per_block_ )
+                {
+                    scramble();
+                    num_stripes_ = 0;
+                }
+            }
+
+            m_ = 0;
+        }
+
+        if( n > buffer_size )
+        {
+            while( n > 64 )
+            {
+                std::uint64_t stripe[ 8 ] = {};
+                for( int j = 0; j < 8; ++j )
+                {
+                    stripe[ j ] = detail::read64le( p + ( 8 * j ) );
+                }
+                accumulate( stripe, 8 * num_stripes_ );
+                ++num_stripes_;
+
+                if( num_stripes_ == stripes_per_block_ )
+                {
+                    scramble();
+                    num_stripes_ = 0;
+                }
+
+                p += 64;
+                n -= 64;
+            }
+
+            detail::memcpy( buffer_ + buffer_size - 64, p - 64, 64 );
+
+            BOOST_ASSERT( n <= 64 );
+        }
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        result_type r;
+
+        if( n_ == 0 )
+        {
+           r = xxh3_128_digest_empty( short_secret(), seed_ );
+
+            // perturb state to enable result extension
+            seed_ += P64_5;
+        }
+        else if( n_ < 4 )
+        {
+            r = xxh3_128_digest_1to3( short_secret(), seed_, buffer_, n_ );
+        }
+        else if( n_ < 9 )
+        {
+            r = xxh3_128_digest_4to8( short_secret(), seed_, buffer_, n_ );
+        }
+        else if( n_ < 17 )
+        {
+            r = xxh3_128_digest_9to16( short_secret(), seed_, buffer_, n_ );
+        }
+        else if( n_ < 129 )
+        {
+            r = xxh3_128_digest_17to128( short_secret(), seed_, buffer_, n_ );
+        }
+        else if( n_ < 241 )
+        {
+            r = xxh3_128_digest_129to240( short_secret(), seed_, buffer_, n_ );
+        }
+        else
+        {
+            r = xxh3_128_digest_long();
+
+            // perturb state to enable result extension
+            acc_[ 0 ] -= P64_1;
+            acc_[ 1 ] += P64_1;
+            acc_[ 2 ] -= P64_2;
+            acc_[ 3 ] += P64_2;
+            acc_[ 4 ] -= P64_3;
+            acc_[ 5 ] += P64_3;
+            acc_[ 6 ] -= P64_4;
+            acc_[ 7 ] += P64_4;
+        }
+
+        // finalize buffer to clear plainext and enable result extension
+
+        {
+            std::uint64_t h1 = detail::read64le( r.data() + 0 );
+            std::uint64_t h2 = detail::read64le( r.data() + 8 );
+
+            std::uint64_t v1 = detail::read64le( buffer_ + 0 );
+            detail::write64le( buffer_ + 0, v1 + h1 );
+
+            std::uint64_t v2 = detail::read64le( buffer_ + 8 );
+            detail::write64le( buffer_ + 8, v2 + h2 );
+
+            detail::memset( buffer_ + 16, 0, buffer_size - 16 );
+        }
+
+        return r;
+    }
+
+};
+
+} // namespace detail
+
+class xxh3_128: public detail::xxh3_128_base<xxh3_128>
+{
+private:
+
+    unsigned char secret_[ default_secret_len ] = {};
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void init_secret_from_seed( std::uint64_t seed )
+    {
+        auto const secret = xxh3_128_constants<>::default_secret;
+
+        std::size_t num_rounds = default_secret_len / 16;
+        for( std::size_t i = 0; i < num_rounds; ++i )
+        {
+            auto low  = detail::read64le( secret + 16 * i ) + seed;
+            auto high = detail::read64le( secret + 16 * i + 8 ) - seed;
+
+            detail::write64le( secret_ + 16 * i, low );
+            detail::write64le( secret_ + 16 * i + 8, high );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR unsigned char const* secret_data_() const
+    {
+        return secret_;
+    }
+
+public:
+
     BOOST_CXX14_CONSTEXPR xxh3_128()
     {
         detail::memcpy( secret_, xxh3_128_constants<>::default_secret, default_secret_len );
     }
 
-    BOOST_CXX14_CONSTEXPR explicit xxh3_128( std::uint64_t seed ): seed_( seed )
+    BOOST_CXX14_CONSTEXPR explicit xxh3_128( std::uint64_t seed ): xxh3_128_base( seed, false, default_secret_len )
     {
         init_secret_from_seed( seed );
     }
@@ -537,7 +723,7 @@ public:
 
 private: // supporting constructor for the static factory functions
 
-    BOOST_CXX14_CONSTEXPR xxh3_128( std::uint64_t seed, unsigned char const* p, std::size_t n, bool with_secret ): seed_( seed ), with_secret_( with_secret )
+    BOOST_CXX14_CONSTEXPR xxh3_128( std::uint64_t seed, unsigned char const* p, std::size_t n, bool with_secret ): xxh3_128_base( seed, with_secret, default_secret_len )
     {
         if( n < min_secret_len )
         {
@@ -628,151 +814,117 @@ public:
         return with_secret_and_seed( static_cast<unsigned char const*>( p ), n, seed );
     }
 
-    void update( void const* p, std::size_t n )
-    {
-        update( static_cast<unsigned char const*>( p ), n );
-    }
+private:
 
-    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
-    {
-        if( n == 0 ) return;
+    friend class detail::xxh3_128_base<xxh3_128>;
+    friend class xxh3_secret;
+    friend struct detail::hash_bytes_impl<xxh3_128>;
+};
 
-        std::size_t const stripes_per_block_ = ( secret_len_ - 64 ) / 8;
+// a secret derived once from a seed or a byte sequence, to be shared by
+// any number of xxh3_128_shared instances, which then don't need to derive
+// or copy it on construction
 
-        n_ += n;
+class xxh3_secret
+{
+private:
 
-        if( n <= buffer_size - m_ )
-        {
-            detail::memcpy( buffer_ + m_, p, n );
-            m_ += n;
-            return;
-        }
+    unsigned char secret_[ 192 ] = {};
+    std::uint64_t seed_ = 0;
+    bool with_secret_ = false;
 
-        if( m_ > 0 )
-        {
-            std::size_t k = buffer_size - m_;
-            detail::memcpy( buffer_ + m_, p, k );
+    std::size_t secret_len_ = 192;
 
-            p += k;
-            n -= k;
+private:
 
-            for( std::size_t i = 0; i < 4; ++i )
-            {
-                std::uint64_t stripe[ 8 ] = {};
-                for( int j = 0; j < 8; ++j )
-                {
-                    stripe[ j ] = detail::read64le( buffer_ + ( 64 * i)  + ( 8 * j ) );
-                }
-                accumulate( stripe, 8 * num_stripes_ );
-                ++num_stripes_;
+    friend class xxh3_128_shared;
 
-                if( num_stripes_ == stripes_per_block_ )
-                {
-                    scramble();
-                    num_stripes_ = 0;
-                }
-            }
+    BOOST_CXX14_CONSTEXPR explicit xxh3_secret( xxh3_128 const& h ): seed_( h.seed_ ), with_secret_( h.with_secret_ ), secret_len_( h.secret_len_ )
+    {
+        detail::memcpy( secret_, h.secret_, 192 );
+    }
 
-            m_ = 0;
-        }
+public:
 
-        if( n > buffer_size )
-        {
-            while( n > 64 )
-            {
-                std::uint64_t stripe[ 8 ] = {};
-                for( int j = 0; j < 8; ++j )
-                {
-                    stripe[ j ] = detail::read64le( p + ( 8 * j ) );
-                }
-                accumulate( stripe, 8 * num_stripes_ );
-                ++num_stripes_;
+    BOOST_CXX14_CONSTEXPR xxh3_secret(): xxh3_secret( xxh3_128() )
+    {
+    }
 
-                if( num_stripes_ == stripes_per_block_ )
-                {
-                    scramble();
-                    num_stripes_ = 0;
-                }
+    BOOST_CXX14_CONSTEXPR explicit xxh3_secret( std::uint64_t seed ): xxh3_secret( xxh3_128( seed ) )
+    {
+    }
 
-                p += 64;
-                n -= 64;
-            }
+    xxh3_secret( void const* p, std::size_t n ): xxh3_secret( static_cast<unsigned char const*>( p ), n )
+    {
+    }
 
-            detail::memcpy( buffer_ + buffer_size - 64, p - 64, 64 );
+    BOOST_CXX14_CONSTEXPR xxh3_secret( unsigned char const* p, std::size_t n ): xxh3_secret( xxh3_128( p, n ) )
+    {
+    }
 
-            BOOST_ASSERT( n <= 64 );
-        }
+    // named constructors, matching those of xxh3_128
 
-        if( n > 0 )
-        {
-            detail::memcpy( buffer_, p, n );
-            m_ = n;
-        }
+    static BOOST_CXX14_CONSTEXPR xxh3_secret with_seed( std::uint64_t seed )
+    {
+        return xxh3_secret( seed );
     }
 
-    BOOST_CXX14_CONSTEXPR result_type result()
+    static BOOST_CXX14_CONSTEXPR xxh3_secret with_secret( unsigned char const* p, std::size_t n )
     {
-        result_type r;
+        return xxh3_secret( xxh3_128::with_secret( p, n ) );
+    }
 
-        if( n_ == 0 )
-        {
-           r = xxh3_128_digest_empty();
+    static xxh3_secret with_secret( void const* p, std::size_t n )
+    {
+        return with_secret( static_cast<unsigned char const*>( p ), n );
+    }
 
-            // perturb state to enable result extension
-            seed_ += P64_5;
-        }
-        else if( n_ < 4 )
-        {
-            r = xxh3_128_digest_1to3();
-        }
-        else if( n_ < 9 )
-        {
-            r = xxh3_128_digest_4to8();
-        }
-        else if( n_ < 17 )
-        {
-            r = xxh3_128_digest_9to16();
-        }
-        else if( n_ < 129 )
-        {
-            r = xxh3_128_digest_17to128();
-        }
-        else if( n_ < 241 )
-        {
-            r = xxh3_128_digest_129to240();
-        }
-        else
-        {
-            r = xxh3_128_digest_long();
+    static BOOST_CXX14_CONSTEXPR xxh3_secret with_secret_and_seed( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        return xxh3_secret( xxh3_128::with_secret_and_seed( p, n, seed ) );
+    }
 
-            // perturb state to enable result extension
-            acc_[ 0 ] -= P64_1;
-            acc_[ 1 ] += P64_1;
-            acc_[ 2 ] -= P64_2;
-            acc_[ 3 ] += P64_2;
-            acc_[ 4 ] -= P64_3;
-            acc_[ 5 ] += P64_3;
-            acc_[ 6 ] -= P64_4;
-            acc_[ 7 ] += P64_4;
-        }
+    static xxh3_secret with_secret_and_seed( void const* p, std::size_t n, std::uint64_t seed )
+    {
+        return with_secret_and_seed( static_cast<unsigned char const*>( p ), n, seed );
+    }
 
-        // finalize buffer to clear plainext and enable result extension
+    BOOST_CXX14_CONSTEXPR unsigned char const* data() const noexcept
+    {
+        return secret_;
+    }
 
-        {
-            std::uint64_t h1 = detail::read64le( r.data() + 0 );
-            std::uint64_t h2 = detail::read64le( r.data() + 8 );
+    BOOST_CXX14_CONSTEXPR std::size_t size() const noexcept
+    {
+        return secret_len_;
+    }
+};
 
-            std::uint64_t v1 = detail::read64le( buffer_ + 0 );
-            detail::write64le( buffer_ + 0, v1 + h1 );
+// xxh3_128, referring to the secret of an xxh3_secret instead of
+// holding a copy; s must outlive *this and its copies
 
-            std::uint64_t v2 = detail::read64le( buffer_ + 8 );
-            detail::write64le( buffer_ + 8, v2 + h2 );
+class xxh3_128_shared: public detail::xxh3_128_base<xxh3_128_shared>
+{
+private:
 
-            detail::memset( buffer_ + 16, 0, buffer_size - 16 );
-        }
+    unsigned char const* secret_;
 
-        return r;
+private:
+
+    BOOST_CXX14_CONSTEXPR unsigned char const* secret_data_() const
+    {
+        return secret_;
     }
+
+public:
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_128_shared( xxh3_secret const& s ): xxh3_128_base( s.seed_, s.with_secret_, s.secret_len_ ), secret_( s.secret_ )
+    {
+    }
+
+private:
+
+    friend class detail::xxh3_128_base<xxh3_128_shared>;
 };
 
 } // namespace hash2
@@ -8,6 +8,7 @@
 // xxHash, https://cyan4973.github.io/xxHash/
 
 #include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memset.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
@@ -27,6 +28,13 @@ namespace boost
 namespace hash2
 {
 
+namespace detail
+{
+
+template<class H> struct hash_bytes_impl;
+
+} // namespace detail
+
 class xxhash_32
 {
 private:
@@ -313,6 +321,76 @@ private:
         v4_ = v4; 
     }
 
+    // the accumulator before the final m bytes are mixed in
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t converge() const
+    {
+        std::uint64_t h = 0;
+
+        if( n_ >= 32 )
+        {
+            h = detail::rotl( v1_, 1 ) + detail::rotl( v2_, 7 ) + detail::rotl( v3_, 12 ) + detail::rotl( v4_, 18 );
+
+            h = merge_round( h, v1_ );
+            h = merge_round( h, v2_ );
+            h = merge_round( h, v3_ );
+            h = merge_round( h, v4_ );
+        }
+        else
+        {
+            h = v3_ + P5;
+        }
+
+        h += n_;
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t mix_tail( std::uint64_t h, unsigned char const* p, std::size_t m )
+    {
+        while( m >= 8 )
+        {
+            std::uint64_t k1 = round( 0, detail::read64le( p ) );
+
+            h ^= k1;
+            h = detail::rotl( h, 27 ) * P1 + P4;
+
+            p += 8;
+            m -= 8;
+        }
+
+        while( m >= 4 )
+        {
+            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
+            h = detail::rotl( h, 23 ) * P2 + P3;
+
+            p += 4;
+            m -= 4;
+        }
+
+        while( m > 0 )
+        {
+            h ^= p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+
+            ++p;
+            --m;
+        }
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t avalanche( std::uint64_t h )
+    {
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
 public:
 
     typedef std::uint64_t result_type;
@@ -396,60 +474,80 @@ public:
         update( p, n );
     }
 
-    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    // equivalent to update() with the bytes of w in little endian order;
+    // a word that fits into the buffer is stored into it directly
+
+    BOOST_CXX14_CONSTEXPR void update_u32( std::uint32_t w )
     {
         BOOST_ASSERT( m_ == n_ % 32 );
 
-        std::uint64_t h = 0;
-
-        if( n_ >= 32 )
+        if( m_ + 4 > 32 )
         {
-            h = detail::rotl( v1_, 1 ) + detail::rotl( v2_, 7 ) + detail::rotl( v3_, 12 ) + detail::rotl( v4_, 18 );
+            unsigned char tmp[ 4 ] = {};
+            detail::write32le( tmp, w );
 
-            h = merge_round( h, v1_ );
-            h = merge_round( h, v2_ );
-            h = merge_round( h, v3_ );
-            h = merge_round( h, v4_ );
+            std::size_t const k = 32 - m_;
+
+            detail::memcpy( buffer_ + m_, tmp, k );
+            update_( buffer_, 1 );
+            detail::memcpy( buffer_, tmp + k, 4 - k );
+
+            n_ += 4;
+            m_ = 4 - k;
+
+            return;
         }
-        else
+
+        detail::write32le( buffer_ + m_, w );
+
+        n_ += 4;
+        m_ += 4;
+
+        if( m_ == 32 )
         {
-            h = v3_ + P5;
+            update_( buffer_, 1 );
+            m_ = 0;
         }
+    }
 
-        h += n_;
+    BOOST_CXX14_CONSTEXPR void update_u64( std::uint64_t w )
+    {
+        BOOST_ASSERT( m_ == n_ % 32 );
 
-        unsigned char const * p = buffer_;
+        if( m_ + 8 > 32 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, w );
 
-        std::size_t m = m_;
+            std::size_t const k = 32 - m_;
 
-        while( m >= 8 )
-        {
-            std::uint64_t k1 = round( 0, detail::read64le( p ) );
+            detail::memcpy( buffer_ + m_, tmp, k );
+            update_( buffer_, 1 );
+            detail::memcpy( buffer_, tmp + k, 8 - k );
 
-            h ^= k1;
-            h = detail::rotl( h, 27 ) * P1 + P4;
+            n_ += 8;
+            m_ = 8 - k;
 
-            p += 8;
-            m -= 8;
+            return;
         }
 
-        while( m >= 4 )
-        {
-            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
-            h = detail::rotl( h, 23 ) * P2 + P3;
+        detail::write64le( buffer_ + m_, w );
 
-            p += 4;
-            m -= 4;
-        }
+        n_ += 8;
+        m_ += 8;
 
-        while( m > 0 )
+        if( m_ == 32 )
         {
-            h ^= p[0] * P5;
-            h = detail::rotl( h, 11 ) * P1;
-
-            ++p;
-            --m;
+            update_( buffer_, 1 );
+            m_ = 0;
         }
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    {
+        BOOST_ASSERT( m_ == n_ % 32 );
+
+        std::uint64_t h = mix_tail( converge(), buffer_, m_ );
 
         n_ += 32 - m_;
         m_ = 0;
@@ -464,14 +562,12 @@ public:
         v4_ -= h;
 
         // apply final mix
-        h ^= h >> 33;
-        h *= P2;
-        h ^= h >> 29;
-        h *= P3;
-        h ^= h >> 32;
-
-        return h;
+        return avalanche( h );
     }
+
+private:
+
+    friend struct detail::hash_bytes_impl<xxhash_64>;
 };
 
 } // namespace hash2
@@ -0,0 +1,166 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Endian-independent test
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <bitset>
+#include <cstddef>
+
+static bool bit( std::size_t i )
+{
+    return ( ( i * 0x9E3779B97F4A7C15ull ) >> 61 ) & 1;
+}
+
+static std::vector<unsigned char> pack( std::vector<bool> const& v )
+{
+    std::vector<unsigned char> r( ( v.size() + 7 ) / 8 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        if( v[ i ] )
+        {
+            r[ i / 8 ] |= static_cast<unsigned char>( 1 << ( i % 8 ) );
+        }
+    }
+
+    return r;
+}
+
+template<class Hash, class Flavor> void test_vector( std::size_t n )
+{
+    std::vector<bool> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = bit( i );
+    }
+
+    std::vector<unsigned char> w = pack( v );
+
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    Hash h2;
+    boost::hash2::hash_append_range( h2, f, w.data(), w.data() + w.size() );
+    boost::hash2::hash_append_size( h2, f, n );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+template<class Hash, class Flavor, std::size_t N> void test_bitset()
+{
+    std::bitset<N> v;
+    std::vector<bool> v2( N );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        v[ i ] = v2[ i ] = bit( i );
+    }
+
+    std::vector<unsigned char> w = pack( v2 );
+
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    Hash h2;
+    boost::hash2::hash_append_range( h2, f, w.data(), w.data() + w.size() );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+template<class Hash, class Flavor> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 7, 8, 9, 63, 64, 65, 100, 4095, 4096, 4097, 10000 };
+
+    for( std::size_t n: sizes )
+    {
+        test_vector<Hash, Flavor>( n );
+    }
+
+    test_bitset<Hash, Flavor, 1>();
+    test_bitset<Hash, Flavor, 8>();
+    test_bitset<Hash, Flavor, 13>();
+    test_bitset<Hash, Flavor, 64>();
+    test_bitset<Hash, Flavor, 65>();
+    test_bitset<Hash, Flavor, 200>();
+    test_bitset<Hash, Flavor, 4097>();
+}
+
+template<class Hash> void test()
+{
+    using namespace boost::hash2;
+
+    test<Hash, default_flavor>();
+    test<Hash, little_endian_flavor>();
+    test<Hash, big_endian_flavor>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_32>();
+    test<xxhash_64>();
+    test<siphash_32>();
+    test<siphash_64>();
+
+    // bit i is bit i % 8 of byte i / 8
+
+    {
+        std::vector<bool> v{ true, false, false, false, false, false, false, false, false, true };
+        unsigned char const w[] = { 0x01, 0x02 };
+
+        fnv1a_64 h1, h2;
+        big_endian_flavor f;
+
+        hash_append( h1, f, v );
+
+        h2.update( w, 2 );
+        hash_append_size( h2, f, 10 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        std::bitset<12> v( 0xA53 );
+        unsigned char const w[] = { 0x53, 0x0A };
+
+        fnv1a_64 h1, h2;
+        default_flavor f;
+
+        hash_append( h1, f, v );
+        h2.update( w, 2 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // std::bitset<0> is hashed as a single zero byte
+
+    {
+        std::bitset<0> v;
+        unsigned char const w[] = { 0x00 };
+
+        fnv1a_64 h1, h2;
+        default_flavor f;
+
+        hash_append( h1, f, v );
+        h2.update( w, 1 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
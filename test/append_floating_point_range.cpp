@@ -0,0 +1,150 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <vector>
+#include <cstddef>
+
+template<class T> std::vector<T> make_vector( std::size_t n )
+{
+    std::vector<T> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        switch( i % 8 )
+        {
+        case 0: v[ i ] = +0.0f; break;
+        case 1: v[ i ] = -0.0f; break;
+        case 2: v[ i ] = std::numeric_limits<T>::infinity(); break;
+        case 3: v[ i ] = -std::numeric_limits<T>::infinity(); break;
+        case 4: v[ i ] = std::numeric_limits<T>::quiet_NaN(); break;
+        case 5: v[ i ] = std::numeric_limits<T>::denorm_min(); break;
+        default: v[ i ] = static_cast<T>( i ) / 7; break;
+        }
+    }
+
+    return v;
+}
+
+template<class Hash, class Flavor, class T> void test( std::size_t n )
+{
+    std::vector<T> v = make_vector<T>( n );
+
+    typename Hash::result_type r1, r2, r3;
+
+    {
+        Hash h;
+        Flavor f;
+
+        boost::hash2::hash_append_range( h, f, v.data(), v.data() + v.size() );
+
+        r1 = h.result();
+    }
+
+    {
+        Hash h;
+        Flavor f;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            boost::hash2::hash_append( h, f, v[ i ] );
+        }
+
+        r2 = h.result();
+    }
+
+    BOOST_TEST_EQ( r1, r2 );
+
+    {
+        Hash h;
+        Flavor f;
+
+        boost::hash2::hash_append( h, f, v );
+
+        r3 = h.result();
+    }
+
+    {
+        Hash h;
+        Flavor f;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            boost::hash2::hash_append( h, f, v[ i ] );
+        }
+
+        boost::hash2::hash_append_size( h, f, n );
+
+        r2 = h.result();
+    }
+
+    BOOST_TEST_EQ( r3, r2 );
+}
+
+template<class Hash, class Flavor> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 3, 7, 63, 64, 65, 127, 128, 129, 255, 256, 257, 1000 };
+
+    for( std::size_t n: sizes )
+    {
+        test<Hash, Flavor, float>( n );
+        test<Hash, Flavor, double>( n );
+    }
+}
+
+template<class Hash> void test()
+{
+    using namespace boost::hash2;
+
+    test<Hash, default_flavor>();
+    test<Hash, little_endian_flavor>();
+    test<Hash, big_endian_flavor>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_32>();
+    test<xxhash_64>();
+    test<siphash_32>();
+    test<siphash_64>();
+
+    // negative zero
+
+    {
+        float const v1[] = { +0.0f, -0.0f, 1.0f };
+        float const v2[] = { +0.0f, +0.0f, 1.0f };
+
+        fnv1a_64 h1, h2;
+        default_flavor f;
+
+        hash_append_range( h1, f, v1, v1 + 3 );
+        hash_append_range( h2, f, v2, v2 + 3 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        double const v1[] = { -0.0, 1.0, -0.0 };
+        double const v2[] = { +0.0, 1.0, +0.0 };
+
+        fnv1a_64 h1, h2;
+        default_flavor f;
+
+        hash_append_range( h1, f, v1, v1 + 3 );
+        hash_append_range( h2, f, v2, v2 + 3 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,192 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+enum E: std::uint32_t
+{
+    e1 = 0x01020304u,
+    e2 = 0xFFEEDDCCu
+};
+
+enum class F: std::int16_t
+{
+    f1 = -5,
+    f2 = 0x1234
+};
+
+template<class T> std::vector<T> make_vector( std::size_t n )
+{
+    std::vector<T> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<T>( i * 0x9E3779B97F4A7C15ull >> 7 );
+    }
+
+    return v;
+}
+
+template<class Hash, class Flavor, class T> void test( std::vector<T> const& v )
+{
+    std::size_t const n = v.size();
+
+    typename Hash::result_type r1, r2, r3;
+
+    {
+        Hash h;
+        Flavor f;
+
+        boost::hash2::hash_append_range( h, f, v.data(), v.data() + n );
+
+        r1 = h.result();
+    }
+
+    {
+        Hash h;
+        Flavor f;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            boost::hash2::hash_append( h, f, v[ i ] );
+        }
+
+        r2 = h.result();
+    }
+
+    BOOST_TEST_EQ( r1, r2 );
+
+    {
+        Hash h;
+        Flavor f;
+
+        boost::hash2::hash_append( h, f, v );
+
+        r3 = h.result();
+    }
+
+    {
+        Hash h;
+        Flavor f;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            boost::hash2::hash_append( h, f, v[ i ] );
+        }
+
+        boost::hash2::hash_append_size( h, f, n );
+
+        r2 = h.result();
+    }
+
+    BOOST_TEST_EQ( r3, r2 );
+}
+
+template<class Hash, class Flavor, class T> void test( std::size_t n )
+{
+    test<Hash, Flavor>( make_vector<T>( n ) );
+}
+
+template<class Hash, class Flavor> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 3, 7, 63, 64, 65, 127, 128, 129, 255, 256, 257, 1000 };
+
+    for( std::size_t n: sizes )
+    {
+        test<Hash, Flavor, std::int16_t>( n );
+        test<Hash, Flavor, std::uint16_t>( n );
+        test<Hash, Flavor, std::int32_t>( n );
+        test<Hash, Flavor, std::uint32_t>( n );
+        test<Hash, Flavor, std::int64_t>( n );
+        test<Hash, Flavor, std::uint64_t>( n );
+        test<Hash, Flavor, char16_t>( n );
+        test<Hash, Flavor, char32_t>( n );
+        test<Hash, Flavor, long>( n );
+    }
+
+    {
+        std::vector<E> v( 300, e1 );
+        v[ 7 ] = e2;
+
+        test<Hash, Flavor>( v );
+    }
+
+    {
+        std::vector<F> v( 300, F::f1 );
+        v[ 299 ] = F::f2;
+
+        test<Hash, Flavor>( v );
+    }
+}
+
+template<class Hash> void test()
+{
+    using namespace boost::hash2;
+
+    test<Hash, default_flavor>();
+    test<Hash, little_endian_flavor>();
+    test<Hash, big_endian_flavor>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_32>();
+    test<xxhash_64>();
+    test<siphash_32>();
+    test<siphash_64>();
+
+    // big endian representation
+
+    {
+        std::uint32_t const v[] = { 0x01020304u, 0x05060708u };
+        unsigned char const w[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+        fnv1a_64 h1, h2;
+        big_endian_flavor f;
+
+        hash_append_range( h1, f, v, v + 2 );
+        h2.update( w, sizeof(w) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        std::uint16_t const v[] = { 0x0102, 0x0304, 0x0506 };
+        unsigned char const w[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+
+        fnv1a_64 h1, h2;
+        big_endian_flavor f;
+
+        hash_append_range( h1, f, v, v + 3 );
+        h2.update( w, sizeof(w) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        std::uint64_t const v[] = { 0x0102030405060708ull };
+        unsigned char const w[] = { 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01 };
+
+        fnv1a_64 h1, h2;
+        little_endian_flavor f;
+
+        hash_append_range( h1, f, v, v + 1 );
+        h2.update( w, sizeof(w) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
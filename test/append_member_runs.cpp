@@ -0,0 +1,228 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/describe/class.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// records the bytes passed to update, and counts the calls
+
+struct recording_hash
+{
+    std::vector<unsigned char> bytes;
+    int calls = 0;
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        bytes.insert( bytes.end(), p, p + n );
+        ++calls;
+    }
+};
+
+// a tuple-like whose get returns by value
+
+struct Q
+{
+    int a;
+    int b;
+};
+
+namespace std
+{
+
+template<> struct tuple_size<Q>: std::integral_constant<std::size_t, 2>
+{
+};
+
+} // namespace std
+
+template<std::size_t I> int get( Q const& q )
+{
+    return I == 0? q.a: q.b;
+}
+
+// compares hash_append( h, f, v ) against hash_append( h, f, m ) for
+// each member m of v, passed as a tuple of references
+
+template<class Flavor, class T, class... M> void test( T const& v, int calls, M const&... m )
+{
+    Flavor f;
+
+    recording_hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    recording_hash h2;
+
+    int a[] = { ( boost::hash2::hash_append( h2, f, m ), 0 )... };
+    (void)a;
+
+    BOOST_TEST( h1.bytes == h2.bytes );
+
+#if defined(BOOST_HASH2_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+
+    BOOST_TEST_EQ( h1.calls, calls );
+
+#else
+
+    (void)calls;
+
+#endif
+
+    {
+        boost::hash2::siphash_64 h3, h4;
+
+        boost::hash2::hash_append( h3, f, v );
+        int b[] = { ( boost::hash2::hash_append( h4, f, m ), 0 )... };
+        (void)b;
+
+        BOOST_TEST_EQ( h3.result(), h4.result() );
+    }
+
+    {
+        boost::hash2::xxhash_64 h3, h4;
+
+        boost::hash2::hash_append( h3, f, v );
+        int b[] = { ( boost::hash2::hash_append( h4, f, m ), 0 )... };
+        (void)b;
+
+        BOOST_TEST_EQ( h3.result(), h4.result() );
+    }
+}
+
+template<class Flavor> void test_tuple_like()
+{
+    {
+        std::pair<std::uint32_t, std::uint32_t> v( 1, 2 );
+        test<Flavor>( v, 1, v.first, v.second );
+    }
+
+    {
+        // padding between the members
+        std::pair<std::uint8_t, std::uint32_t> v( 1, 2 );
+        test<Flavor>( v, 2, v.first, v.second );
+    }
+
+    {
+        // floating point members aren't contiguously hashable
+        std::pair<float, std::uint32_t> v( -0.0f, 2 );
+        test<Flavor>( v, 2, v.first, v.second );
+    }
+
+    {
+        std::tuple<std::uint32_t, std::uint32_t, std::uint64_t> v( 1, 2, 3 );
+
+        // the layout of std::tuple is unspecified
+        int calls = 1;
+
+        if( &std::get<0>( v ) + 1 != &std::get<1>( v ) ) ++calls;
+        if( static_cast<void const*>( &std::get<1>( v ) + 1 ) != &std::get<2>( v ) ) ++calls;
+
+        test<Flavor>( v, calls, std::get<0>( v ), std::get<1>( v ), std::get<2>( v ) );
+    }
+
+    {
+        // get returns by value
+        Q v = { 1, 2 };
+        test<Flavor>( v, 2, v.a, v.b );
+    }
+
+    {
+        // the elements of std::tie refer to objects outside the tuple,
+        // adjacent or not, and aren't coalesced
+        std::uint32_t w[ 3 ] = { 1, 2, 3 };
+
+        test<Flavor>( std::tie( w[ 0 ], w[ 1 ] ), 2, w[ 0 ], w[ 1 ] );
+        test<Flavor>( std::tie( w[ 2 ], w[ 0 ], w[ 1 ] ), 3, w[ 2 ], w[ 0 ], w[ 1 ] );
+    }
+
+    {
+        std::uint32_t a = 1, b = 2;
+
+        std::pair<std::uint32_t&, std::uint32_t&> v( a, b );
+        test<Flavor>( v, 2, a, b );
+    }
+}
+
+#if defined(BOOST_DESCRIBE_CXX14)
+
+struct X
+{
+    std::uint32_t a;
+    std::uint16_t b;
+    std::uint16_t c;
+    std::uint8_t d;
+    std::uint64_t e;
+    std::uint32_t f[ 3 ];
+    float g;
+    std::int32_t h;
+};
+
+BOOST_DESCRIBE_STRUCT(X, (), (a, b, c, d, e, f, g, h))
+
+struct Y: X
+{
+    std::uint32_t i;
+    std::uint32_t j;
+};
+
+BOOST_DESCRIBE_STRUCT(Y, (X), (i, j))
+
+template<class Flavor> void test_described()
+{
+    Y v;
+
+    v.a = 1;
+    v.b = 2;
+    v.c = 3;
+    v.d = 4;
+    v.e = 5;
+    v.f[ 0 ] = 6;
+    v.f[ 1 ] = 7;
+    v.f[ 2 ] = 8;
+    v.g = -0.0f;
+    v.h = -9;
+    v.i = 10;
+    v.j = 11;
+
+    // { a, b, c, d }, { e, f }, g, h, { i, j }
+    test<Flavor>( v, 5, v.a, v.b, v.c, v.d, v.e, v.f, v.g, v.h, v.i, v.j );
+}
+
+#else
+
+template<class Flavor> void test_described()
+{
+}
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test_tuple_like<default_flavor>();
+    test_described<default_flavor>();
+
+    // in a non-native byte order, integers aren't contiguously hashable,
+    // and the members are hashed one by one
+
+    {
+        std::pair<std::uint32_t, std::uint32_t> v( 1, 2 );
+
+        test<little_endian_flavor>( v, endian::native == endian::little? 1: 2, v.first, v.second );
+        test<big_endian_flavor>( v, endian::native == endian::big? 1: 2, v.first, v.second );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,237 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/describe/class.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <array>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// records the bytes passed to update, and counts the calls
+
+struct recording_hash
+{
+    std::vector<unsigned char> bytes;
+    int calls = 0;
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        bytes.insert( bytes.end(), p, p + n );
+        ++calls;
+    }
+};
+
+// hashes v element by element, and each element with a separate
+// hash_append call per member, via f
+
+template<class Hash, class Flavor, class T, class F> void hash_append_elementwise( Hash& h, Flavor const& fl, std::vector<T> const& v, F f )
+{
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        f( h, fl, v[ i ] );
+    }
+
+    boost::hash2::hash_append_size( h, fl, v.size() );
+}
+
+template<class Flavor, class T, class F> void test( std::vector<T> const& v, int calls, F f )
+{
+    Flavor fl;
+
+    {
+        recording_hash h1, h2;
+
+        boost::hash2::hash_append( h1, fl, v );
+        hash_append_elementwise( h2, fl, v, f );
+
+        BOOST_TEST( h1.bytes == h2.bytes );
+
+#if defined(BOOST_HASH2_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+
+        BOOST_TEST_EQ( h1.calls, calls );
+
+#else
+
+        (void)calls;
+
+#endif
+    }
+
+    {
+        boost::hash2::xxhash_64 h1, h2;
+
+        boost::hash2::hash_append( h1, fl, v );
+        hash_append_elementwise( h2, fl, v, f );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+struct hash_pair
+{
+    template<class Hash, class Flavor, class T1, class T2> void operator()( Hash& h, Flavor const& f, std::pair<T1, T2> const& v ) const
+    {
+        boost::hash2::hash_append( h, f, v.first );
+        boost::hash2::hash_append( h, f, v.second );
+    }
+};
+
+struct hash_array
+{
+    template<class Hash, class Flavor, class T, std::size_t N> void operator()( Hash& h, Flavor const& f, std::array<T, N> const& v ) const
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            boost::hash2::hash_append( h, f, v[ i ] );
+        }
+    }
+};
+
+#if defined(BOOST_DESCRIBE_CXX14)
+
+struct K1
+{
+    std::uint32_t a;
+    std::uint16_t b;
+    std::uint8_t c;
+    std::uint8_t d;
+};
+
+BOOST_DESCRIBE_STRUCT(K1, (), (a, b, c, d))
+
+// not described in declaration order
+
+struct K2
+{
+    std::uint32_t a;
+    std::uint32_t b;
+};
+
+BOOST_DESCRIBE_STRUCT(K2, (), (b, a))
+
+// padding
+
+struct K3
+{
+    std::uint32_t a;
+    std::uint8_t b;
+};
+
+BOOST_DESCRIBE_STRUCT(K3, (), (a, b))
+
+struct hash_K1
+{
+    template<class Hash, class Flavor> void operator()( Hash& h, Flavor const& f, K1 const& v ) const
+    {
+        boost::hash2::hash_append( h, f, v.a );
+        boost::hash2::hash_append( h, f, v.b );
+        boost::hash2::hash_append( h, f, v.c );
+        boost::hash2::hash_append( h, f, v.d );
+    }
+};
+
+struct hash_K2
+{
+    template<class Hash, class Flavor> void operator()( Hash& h, Flavor const& f, K2 const& v ) const
+    {
+        boost::hash2::hash_append( h, f, v.b );
+        boost::hash2::hash_append( h, f, v.a );
+    }
+};
+
+struct hash_K3
+{
+    template<class Hash, class Flavor> void operator()( Hash& h, Flavor const& f, K3 const& v ) const
+    {
+        boost::hash2::hash_append( h, f, v.a );
+        boost::hash2::hash_append( h, f, v.b );
+    }
+};
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    int const N = 17;
+
+    {
+        std::vector< std::pair<std::uint32_t, std::uint32_t> > v;
+
+        for( int i = 0; i < N; ++i )
+        {
+            v.push_back( { static_cast<std::uint32_t>( i ), static_cast<std::uint32_t>( i * 7 ) } );
+        }
+
+        // the elements, and the size
+        test<default_flavor>( v, 2, hash_pair() );
+
+        test<little_endian_flavor>( v, endian::native == endian::little? 2: N * 2 + 1, hash_pair() );
+        test<big_endian_flavor>( v, endian::native == endian::big? 2: N * 2 + 1, hash_pair() );
+    }
+
+    {
+        std::vector< std::array<std::uint16_t, 4> > v;
+
+        for( int i = 0; i < N; ++i )
+        {
+            std::uint16_t x = static_cast<std::uint16_t>( i );
+            v.push_back( {{ x, static_cast<std::uint16_t>( x + 1 ), static_cast<std::uint16_t>( x * 3 ), 0 }} );
+        }
+
+        test<default_flavor>( v, 2, hash_array() );
+    }
+
+#if defined(BOOST_DESCRIBE_CXX14)
+
+    {
+        std::vector<K1> v;
+
+        for( int i = 0; i < N; ++i )
+        {
+            K1 k = { static_cast<std::uint32_t>( i * 0x9E3779B1u ), static_cast<std::uint16_t>( i ), static_cast<std::uint8_t>( i * 3 ), 5 };
+            v.push_back( k );
+        }
+
+        test<default_flavor>( v, 2, hash_K1() );
+    }
+
+    {
+        std::vector<K2> v;
+
+        for( int i = 0; i < N; ++i )
+        {
+            K2 k = { static_cast<std::uint32_t>( i ), static_cast<std::uint32_t>( i * 11 ) };
+            v.push_back( k );
+        }
+
+        // b and a, per element
+        test<default_flavor>( v, N * 2 + 1, hash_K2() );
+    }
+
+    {
+        std::vector<K3> v;
+
+        for( int i = 0; i < N; ++i )
+        {
+            K3 k = { static_cast<std::uint32_t>( i ), static_cast<std::uint8_t>( i ) };
+            v.push_back( k );
+        }
+
+        // a and b as a single run, per element
+        test<default_flavor>( v, N + 1, hash_K3() );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,255 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <deque>
+#include <vector>
+#include <array>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// a fixed capacity ring buffer, exposing its elements as two segments
+
+template<class T, std::size_t N> class ring_buffer
+{
+private:
+
+    T data_[ N ] = {};
+    std::size_t first_ = 0;
+    std::size_t size_ = 0;
+
+public:
+
+    struct segment
+    {
+        T const* p_;
+        std::size_t n_;
+
+        T const* data() const { return p_; }
+        std::size_t size() const { return n_; }
+    };
+
+    class const_iterator
+    {
+    private:
+
+        ring_buffer const* r_;
+        std::size_t i_;
+
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        const_iterator( ring_buffer const* r, std::size_t i ): r_( r ), i_( i ) {}
+
+        T const& operator*() const { return r_->data_[ ( r_->first_ + i_ ) % N ]; }
+        const_iterator& operator++() { ++i_; return *this; }
+        const_iterator operator++( int ) { const_iterator r( *this ); ++i_; return r; }
+
+        bool operator==( const_iterator const& rhs ) const { return i_ == rhs.i_; }
+        bool operator!=( const_iterator const& rhs ) const { return i_ != rhs.i_; }
+    };
+
+    void push_back( T const& v )
+    {
+        if( size_ == N )
+        {
+            data_[ first_ ] = v;
+            first_ = ( first_ + 1 ) % N;
+        }
+        else
+        {
+            data_[ ( first_ + size_ ) % N ] = v;
+            ++size_;
+        }
+    }
+
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end() const { return const_iterator( this, size_ ); }
+
+    std::size_t size() const { return size_; }
+
+    std::array<segment, 2> segments() const
+    {
+        std::size_t n1 = N - first_ < size_? N - first_: size_;
+
+        segment s1 = { data_ + first_, n1 };
+        segment s2 = { data_, size_ - n1 };
+
+        return {{ s1, s2 }};
+    }
+};
+
+struct recording_hash
+{
+    using result_type = std::uint64_t;
+
+    std::uint64_t state_ = 0;
+    std::size_t calls_ = 0;
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            state_ = state_ * 31 + p[ i ];
+        }
+
+        ++calls_;
+    }
+
+    result_type result()
+    {
+        return state_;
+    }
+};
+
+template<class Hash, class Flavor, class T> void test_deque( std::size_t n )
+{
+    std::deque<T> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( i % 3 == 0 )
+        {
+            v.push_front( static_cast<T>( i * 0x9E3779B9u ) );
+        }
+        else
+        {
+            v.push_back( static_cast<T>( i * 0x9E3779B9u ) );
+        }
+    }
+
+    std::vector<T> w( v.begin(), v.end() );
+
+    Flavor f;
+
+    {
+        Hash h1, h2;
+
+        boost::hash2::hash_append( h1, f, v );
+        boost::hash2::hash_append( h2, f, w );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        std::deque<T> const& cv = v;
+
+        std::size_t k1 = n / 3, k2 = n / 2;
+
+        Hash h1, h2;
+
+        boost::hash2::hash_append_range( h1, f, cv.begin() + k1, cv.end() - k2 );
+        boost::hash2::hash_append_range( h2, f, w.begin() + k1, w.end() - k2 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+template<class Hash, class Flavor, class T> void test_ring_buffer( std::size_t n )
+{
+    ring_buffer<T, 97> v;
+    std::deque<T> w;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v.push_back( static_cast<T>( i * 0x9E3779B9u ) );
+        w.push_back( static_cast<T>( i * 0x9E3779B9u ) );
+
+        if( w.size() > 97 ) w.pop_front();
+    }
+
+    Flavor f;
+
+    Hash h1, h2;
+
+    boost::hash2::hash_append( h1, f, v );
+    boost::hash2::hash_append( h2, f, w );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+template<class Hash, class Flavor> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 15, 16, 17, 97, 150, 1000, 5000 };
+
+    for( std::size_t n: sizes )
+    {
+        test_deque<Hash, Flavor, char>( n );
+        test_deque<Hash, Flavor, unsigned char>( n );
+        test_deque<Hash, Flavor, std::uint16_t>( n );
+        test_deque<Hash, Flavor, int>( n );
+        test_deque<Hash, Flavor, std::uint64_t>( n );
+        test_deque<Hash, Flavor, float>( n );
+        test_deque<Hash, Flavor, double>( n );
+
+        test_ring_buffer<Hash, Flavor, char>( n );
+        test_ring_buffer<Hash, Flavor, int>( n );
+        test_ring_buffer<Hash, Flavor, double>( n );
+    }
+}
+
+template<class Hash> void test()
+{
+    using namespace boost::hash2;
+
+    test<Hash, default_flavor>();
+    test<Hash, little_endian_flavor>();
+    test<Hash, big_endian_flavor>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_32>();
+    test<xxhash_64>();
+    test<siphash_32>();
+    test<siphash_64>();
+
+    // elements that can't be hashed in bulk
+
+    {
+        std::deque<std::string> v = { "a", "bc", "def" };
+        std::vector<std::string> w( v.begin(), v.end() );
+
+        fnv1a_64 h1, h2;
+
+        hash_append( h1, {}, v );
+        hash_append( h2, {}, w );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // a segment is passed to Hash::update at once
+
+    {
+        ring_buffer<int, 16> v;
+
+        for( int i = 0; i < 20; ++i )
+        {
+            v.push_back( i );
+        }
+
+        recording_hash h;
+        hash_append( h, {}, v );
+
+        BOOST_TEST_EQ( h.calls_, 3u ); // two segments, and the size
+    }
+
+    return boost::report_errors();
+}
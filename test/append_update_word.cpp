@@ -0,0 +1,207 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// hides the word update hooks of H
+
+template<class H> class bytes_only
+{
+private:
+
+    H h_;
+
+public:
+
+    using result_type = typename H::result_type;
+
+    bytes_only() = default;
+
+    void update( void const* p, std::size_t n )
+    {
+        h_.update( p, n );
+    }
+
+    result_type result()
+    {
+        return h_.result();
+    }
+};
+
+// counts the calls to the word update hooks
+
+struct counting_hash
+{
+    using result_type = std::uint64_t;
+
+    boost::hash2::fnv1a_64 h;
+
+    int bytes = 0;
+    int words = 0;
+
+    void update( void const* p, std::size_t n )
+    {
+        h.update( p, n );
+        ++bytes;
+    }
+
+    void update_u32( std::uint32_t w )
+    {
+        h.update_u32( w );
+        ++words;
+    }
+
+    void update_u64( std::uint64_t w )
+    {
+        h.update_u64( w );
+        ++words;
+    }
+
+    result_type result()
+    {
+        return h.result();
+    }
+};
+
+enum E: std::uint32_t
+{
+    e1 = 0x01020304
+};
+
+struct X
+{
+    std::uint8_t a;
+    std::uint32_t b;
+    std::int64_t c;
+    std::uint16_t d;
+    E e;
+    double f;
+    float g;
+};
+
+template<class Hash, class Flavor> void hash_append_X( Hash& h, Flavor const& f, X const& x )
+{
+    boost::hash2::hash_append( h, f, x.a );
+    boost::hash2::hash_append( h, f, x.b );
+    boost::hash2::hash_append( h, f, x.c );
+    boost::hash2::hash_append( h, f, x.d );
+    boost::hash2::hash_append( h, f, x.e );
+    boost::hash2::hash_append( h, f, x.f );
+    boost::hash2::hash_append( h, f, x.g );
+}
+
+template<class H, class Flavor> void test()
+{
+    Flavor f;
+
+    std::vector<X> v;
+
+    for( int i = 0; i < 37; ++i )
+    {
+        X x = { static_cast<std::uint8_t>( i ), static_cast<std::uint32_t>( i * 0x9E3779B1u ), -i * 0x123456789LL, static_cast<std::uint16_t>( i * 7 ), e1, i * 0.5, i * -0.25f };
+        v.push_back( x );
+    }
+
+    for( std::size_t n = 0; n <= v.size(); ++n )
+    {
+        H h1;
+        bytes_only<H> h2;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            hash_append_X( h1, f, v[ i ] );
+            hash_append_X( h2, f, v[ i ] );
+        }
+
+        boost::hash2::hash_append( h1, f, std::uint64_t( n ) );
+        boost::hash2::hash_append( h2, f, std::uint64_t( n ) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // runs of words at every buffer offset
+
+    for( std::size_t k = 0; k < 8; ++k )
+    {
+        H h1;
+        bytes_only<H> h2;
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            boost::hash2::hash_append( h1, f, std::uint8_t( i ) );
+            boost::hash2::hash_append( h2, f, std::uint8_t( i ) );
+        }
+
+        for( std::uint32_t i = 0; i < 40; ++i )
+        {
+            if( i % 3 == 0 )
+            {
+                boost::hash2::hash_append( h1, f, i );
+                boost::hash2::hash_append( h2, f, i );
+            }
+            else
+            {
+                boost::hash2::hash_append( h1, f, std::uint64_t( i ) << 40 | i );
+                boost::hash2::hash_append( h2, f, std::uint64_t( i ) << 40 | i );
+            }
+        }
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // detection
+
+    BOOST_TEST( detail::has_update_u32<fnv1a_32>::value );
+    BOOST_TEST( detail::has_update_u64<fnv1a_64>::value );
+    BOOST_TEST( detail::has_update_u64<siphash_64>::value );
+    BOOST_TEST( detail::has_update_u64<xxhash_64>::value );
+    BOOST_TEST( !detail::has_update_u32<bytes_only<fnv1a_64>>::value );
+    BOOST_TEST( !detail::has_update_u64<bytes_only<fnv1a_64>>::value );
+
+    {
+        counting_hash h;
+
+        hash_append( h, {}, std::uint8_t( 1 ) );
+        hash_append( h, {}, std::uint16_t( 1 ) );
+        hash_append( h, {}, std::uint32_t( 1 ) );
+        hash_append( h, {}, std::uint64_t( 1 ) );
+        hash_append( h, {}, 1.0 );
+        hash_append( h, {}, e1 );
+
+        BOOST_TEST_EQ( h.bytes, 2 );
+        BOOST_TEST_EQ( h.words, 4 );
+    }
+
+    test<fnv1a_32, default_flavor>();
+    test<fnv1a_32, little_endian_flavor>();
+    test<fnv1a_32, big_endian_flavor>();
+
+    test<fnv1a_64, default_flavor>();
+    test<fnv1a_64, little_endian_flavor>();
+    test<fnv1a_64, big_endian_flavor>();
+
+    test<siphash_64, default_flavor>();
+    test<siphash_64, little_endian_flavor>();
+    test<siphash_64, big_endian_flavor>();
+
+    test<xxhash_64, default_flavor>();
+    test<xxhash_64, little_endian_flavor>();
+    test<xxhash_64, big_endian_flavor>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,146 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/binary_fuse_filter.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class F> std::vector<unsigned char> serialize( F const& f )
+{
+    std::vector<unsigned char> w( f.byte_size() );
+    f.serialize( w.data() );
+
+    return w;
+}
+
+template<class F> void test( std::size_t n, std::uint64_t seed, double max_fp )
+{
+    std::vector<std::string> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v.push_back( "key_" + std::to_string( i ) );
+    }
+
+    // duplicates
+
+    for( std::size_t i = 0; i < n; i += 3 )
+    {
+        v.push_back( "key_" + std::to_string( i ) );
+    }
+
+    F f( v.begin(), v.end(), seed );
+
+    // no false negatives
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( f.contains( v[ i ] ) );
+    }
+
+    // false positives
+
+    std::vector<std::string> w;
+
+    for( std::size_t i = 0; i < 20000; ++i )
+    {
+        w.push_back( "other_" + std::to_string( i ) );
+    }
+
+    std::vector<bool> r;
+    f.contains( w.begin(), w.end(), std::back_inserter( r ) );
+
+    BOOST_TEST_EQ( r.size(), w.size() );
+
+    std::size_t fp = 0;
+
+    for( std::size_t i = 0; i < w.size(); ++i )
+    {
+        BOOST_TEST_EQ( r[ i ], f.contains( w[ i ] ) );
+        fp += r[ i ];
+    }
+
+    BOOST_TEST_LE( static_cast<double>( fp ) / w.size(), max_fp );
+
+    // batched queries of present keys
+
+    {
+        std::vector<bool> r2;
+        f.contains( v.begin(), v.begin() + n, std::back_inserter( r2 ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST( r2[ i ] );
+        }
+    }
+
+    // size; the space overhead is 1.175 for n = 100000, and decreases to 1.125 for n >= 1000000
+
+    if( n >= 100000 )
+    {
+        BOOST_TEST_LT( static_cast<double>( f.fingerprint_count() ) / n, 1.2 );
+    }
+
+    // serialization round trip
+
+    {
+        std::vector<unsigned char> s = serialize( f );
+
+        F f2;
+
+        BOOST_TEST( f2.deserialize( s.data(), s.size() ) );
+        BOOST_TEST( serialize( f2 ) == s );
+        BOOST_TEST_EQ( f2.seed(), f.seed() );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST( f2.contains( v[ i ] ) );
+        }
+
+        for( std::size_t i = 0; i < w.size(); ++i )
+        {
+            BOOST_TEST_EQ( f2.contains( w[ i ] ), r[ i ] );
+        }
+
+        BOOST_TEST( !f2.deserialize( s.data(), s.size() - 1 ) );
+        BOOST_TEST( !f2.deserialize( s.data(), 15 ) );
+
+        s[ 8 ] = 3; // segment length not a power of two
+        BOOST_TEST( !f2.deserialize( s.data(), s.size() ) );
+
+        BOOST_TEST( serialize( f2 ) == serialize( f ) );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    for( std::size_t n: { 0, 1, 2, 3, 10, 100, 1000, 10000, 100000 } )
+    {
+        test< binary_fuse_filter<std::string, xxhash_64> >( n, 0, 0.01 );
+    }
+
+    test< binary_fuse_filter<std::string, siphash_64, 8> >( 10000, 7, 0.01 );
+    test< binary_fuse_filter<std::string, xxhash_64, 16> >( 10000, 1, 0.001 );
+    test< binary_fuse_filter<std::string, xxhash_64, 32, big_endian_flavor> >( 10000, 1, 0.001 );
+
+    // an empty filter
+
+    {
+        binary_fuse_filter<int, xxhash_64, 32> f;
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            BOOST_TEST( !f.contains( i ) );
+        }
+    }
+
+    return boost::report_errors();
+}
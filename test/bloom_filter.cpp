@@ -0,0 +1,223 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/bloom_filter.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class F> void test( F f, F f2 )
+{
+    int const N = 10000;
+
+    std::vector<std::string> v;
+
+    for( int i = 0; i < N; ++i )
+    {
+        v.push_back( "key_" + std::to_string( i ) );
+    }
+
+    // no false negatives
+
+    for( int i = 0; i < N / 2; ++i )
+    {
+        f.insert( v[ i ] );
+    }
+
+    f2.insert( v.begin(), v.begin() + N / 2 );
+
+    for( int i = 0; i < N / 2; ++i )
+    {
+        BOOST_TEST( f.contains( v[ i ] ) );
+        BOOST_TEST( f2.contains( v[ i ] ) );
+    }
+
+    // batched queries agree with individual ones
+
+    std::vector<bool> r;
+    f.contains( v.begin(), v.end(), std::back_inserter( r ) );
+
+    BOOST_TEST_EQ( r.size(), v.size() );
+
+    int fp = 0;
+
+    for( int i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( r[ i ], f.contains( v[ i ] ) );
+
+        if( i >= N / 2 && r[ i ] ) ++fp;
+    }
+
+    // 10 bits per key, 7 hashes: the false positive rate is about 1%
+
+    BOOST_TEST_LT( fp, N / 2 / 25 );
+
+    // serialization round trip
+
+    {
+        std::vector<unsigned char> w( f.byte_size() );
+        f.serialize( w.data() );
+
+        std::vector<unsigned char> w2( f2.byte_size() );
+        f2.serialize( w2.data() );
+
+        BOOST_TEST( w == w2 );
+
+        F f3( f );
+        f3.clear();
+
+        for( int i = 0; i < N / 2; ++i )
+        {
+            BOOST_TEST( !f3.contains( v[ i ] ) );
+        }
+
+        BOOST_TEST( f3.deserialize( w.data(), w.size() ) );
+
+        std::vector<unsigned char> w3( f3.byte_size() );
+        f3.serialize( w3.data() );
+
+        BOOST_TEST( w == w3 );
+
+        // truncated or corrupted input is rejected, leaving f3 unchanged
+
+        BOOST_TEST( !f3.deserialize( w.data(), 0 ) );
+        BOOST_TEST( !f3.deserialize( w.data(), 16 ) );
+        BOOST_TEST( !f3.deserialize( w.data(), w.size() - 8 ) );
+        BOOST_TEST( !f3.deserialize( w.data(), w.size() - 1 ) );
+
+        for( std::size_t i = 0; i < 24; i += 4 )
+        {
+            std::vector<unsigned char> w4( w );
+            w4[ i ] ^= 1;
+
+            BOOST_TEST( !f3.deserialize( w4.data(), w4.size() ) );
+        }
+
+        f3.serialize( w3.data() );
+        BOOST_TEST( w == w3 );
+
+        for( int i = 0; i < N; ++i )
+        {
+            BOOST_TEST_EQ( f3.contains( v[ i ] ), f.contains( v[ i ] ) );
+        }
+    }
+
+    // copies
+
+    {
+        F f3( f );
+
+        for( int i = 0; i < N; ++i )
+        {
+            BOOST_TEST_EQ( f3.contains( v[ i ] ), f.contains( v[ i ] ) );
+        }
+
+        F f4( 64, 1 );
+        f4 = f;
+
+        for( int i = 0; i < N; ++i )
+        {
+            BOOST_TEST_EQ( f4.contains( v[ i ] ), f.contains( v[ i ] ) );
+        }
+    }
+
+    // union
+
+    {
+        F f3( f );
+        f3.clear();
+
+        f3.insert( v.begin() + N / 2, v.end() );
+        f3 |= f;
+
+        for( int i = 0; i < N; ++i )
+        {
+            BOOST_TEST( f3.contains( v[ i ] ) );
+        }
+    }
+}
+
+// deserializes the data of f into f2; returns whether that succeeded,
+// checking that f2 is unchanged when it didn't
+
+template<class F, class F2> bool test_deserialize( F const& f, F2 f2, bool accept )
+{
+    std::vector<unsigned char> w( f.byte_size() );
+    f.serialize( w.data() );
+
+    std::vector<unsigned char> w2( f2.byte_size() );
+    f2.serialize( w2.data() );
+
+    bool r = f2.deserialize( w.data(), w.size() );
+
+    std::vector<unsigned char> w3( f2.byte_size() );
+    f2.serialize( w3.data() );
+
+    BOOST_TEST( w3 == ( r? w: w2 ) );
+
+    return r == accept;
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    std::size_t const m = 10 * 10000 / 2;
+
+    test( bloom_filter<std::string, xxhash_64>( m, 7 ), bloom_filter<std::string, xxhash_64>( m, 7 ) );
+    test( bloom_filter<std::string, siphash_64>( m, 7, 1 ), bloom_filter<std::string, siphash_64>( m, 7, 1 ) );
+    test( bloom_filter<std::string, siphash_64>( m, 7, "seed", 4 ), bloom_filter<std::string, siphash_64>( m, 7, "seed", 4 ) );
+
+    test( blocked_bloom_filter<std::string, xxhash_64>( m, 7 ), blocked_bloom_filter<std::string, xxhash_64>( m, 7 ) );
+    test( blocked_bloom_filter<std::string, siphash_64>( m, 7, 1 ), blocked_bloom_filter<std::string, siphash_64>( m, 7, 1 ) );
+    test( blocked_bloom_filter<std::string, siphash_64, big_endian_flavor>( m, 7 ), blocked_bloom_filter<std::string, siphash_64, big_endian_flavor>( m, 7 ) );
+
+    // different seeds produce different bit arrays
+
+    {
+        bloom_filter<int, xxhash_64> f1( 1024, 3 ), f2( 1024, 3, 7 );
+
+        f1.insert( 1 );
+        f2.insert( 1 );
+
+        std::vector<unsigned char> w1( f1.byte_size() ), w2( f2.byte_size() );
+
+        f1.serialize( w1.data() );
+        f2.serialize( w2.data() );
+
+        BOOST_TEST( w1 != w2 );
+    }
+
+    // filters with different parameters or seeds reject each other's data
+
+    {
+        bloom_filter<int, xxhash_64> f( 1024, 3 );
+        f.insert( 1 );
+
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, xxhash_64>( 1024, 3 ), true ) );
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, xxhash_64>( 1024, 4 ), false ) );
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, xxhash_64>( 2048, 3 ), false ) );
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, xxhash_64>( 1024, 3, 7 ), false ) );
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, xxhash_64>( 1024, 3, "seed", 4 ), false ) );
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, siphash_64>( 1024, 3 ), false ) );
+        BOOST_TEST( test_deserialize( f, blocked_bloom_filter<int, xxhash_64>( 1024, 3 ), false ) );
+    }
+
+    {
+        blocked_bloom_filter<int, xxhash_64> f( 1024, 3 );
+        f.insert( 1 );
+
+        BOOST_TEST( test_deserialize( f, blocked_bloom_filter<int, xxhash_64>( 1024, 3 ), true ) );
+        BOOST_TEST( test_deserialize( f, blocked_bloom_filter<int, xxhash_64>( 1024, 4 ), false ) );
+        BOOST_TEST( test_deserialize( f, blocked_bloom_filter<int, xxhash_64>( 2048, 3 ), false ) );
+        BOOST_TEST( test_deserialize( f, blocked_bloom_filter<int, xxhash_64>( 1024, 3, 7 ), false ) );
+        BOOST_TEST( test_deserialize( f, bloom_filter<int, xxhash_64>( 1024, 3 ), false ) );
+    }
+
+    return boost::report_errors();
+}
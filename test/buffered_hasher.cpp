@@ -0,0 +1,143 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/buffered_hasher.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, class T> typename H::result_type hash_value( T const& v, std::uint64_t seed )
+{
+    H h( seed );
+    boost::hash2::hash_append( h, {}, v );
+
+    return h.result();
+}
+
+template<class H, class B, class T> void test_value( T const& v )
+{
+    for( std::uint64_t seed: { 0ull, 7ull } )
+    {
+        BOOST_TEST( hash_value<H>( v, seed ) == hash_value<B>( v, seed ) );
+    }
+}
+
+template<class H, class B> void test_composite()
+{
+    std::vector< std::pair<int, short> > v1;
+    std::vector< std::tuple<char, std::uint64_t, float, std::string> > v2;
+
+    for( int i = 0; i < 300; ++i )
+    {
+        v1.push_back( { i * 31, static_cast<short>( i ) } );
+        v2.push_back( std::make_tuple( static_cast<char>( i ), i * 0x9E3779B97F4A7C15ull, i * 0.5f, std::string( i % 70, 'x' ) ) );
+
+        test_value<H, B>( v1 );
+        test_value<H, B>( v2 );
+    }
+
+    test_value<H, B>( std::string( 1000, 'y' ) );
+}
+
+template<class H, class B> void test_updates()
+{
+    std::vector<unsigned char> v( 2000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 13 + 5 );
+    }
+
+    H h1;
+    B h2;
+
+    std::size_t sizes[] = { 0, 1, 3, 8, 255, 256, 257, 17, 600, 4, 31 };
+
+    std::size_t i = 0;
+
+    for( std::size_t n: sizes )
+    {
+        h1.update( v.data() + i, n );
+        h2.update( v.data() + i, n );
+
+        i += n;
+    }
+
+    BOOST_TEST( h1.result() == h2.result() );
+
+    // repeated calls to result
+
+    BOOST_TEST( h1.result() == h2.result() );
+    BOOST_TEST( h1.result() == h2.result() );
+}
+
+template<class H, class B> void test_constructors()
+{
+    unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+    {
+        H h1( seed, sizeof( seed ) );
+        B h2( seed, sizeof( seed ) );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        H h1( static_cast<void const*>( seed ), sizeof( seed ) );
+        B h2( static_cast<void const*>( seed ), sizeof( seed ) );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        H h1( 0x9E3779B9 );
+        B h2( h1 );
+
+        hash_append( h1, {}, 1 );
+        hash_append( h2, {}, 1 );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+}
+
+template<class H> void test()
+{
+    using boost::hash2::buffered_hasher;
+
+    test_composite< H, buffered_hasher<H> >();
+    test_composite< H, buffered_hasher<H, 8> >();
+    test_composite< H, buffered_hasher<H, 13> >();
+
+    test_updates< H, buffered_hasher<H> >();
+    test_updates< H, buffered_hasher<H, 8> >();
+    test_updates< H, buffered_hasher<H, 13> >();
+
+    test_constructors< H, buffered_hasher<H> >();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_32>();
+    test<xxhash_64>();
+    test<xxh3_128>();
+    test<siphash_32>();
+    test<siphash_64>();
+    test<sha2_256>();
+
+    return boost::report_errors();
+}
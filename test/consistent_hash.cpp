@@ -0,0 +1,301 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/consistent_hash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+void test_jump()
+{
+    using boost::hash2::jump_consistent_hash;
+
+    std::uint64_t x = 0;
+
+    std::size_t const N = 10000;
+    std::int32_t const B = 64;
+
+    std::vector<std::uint64_t> keys;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        keys.push_back( boost::hash2::detail::splitmix64( x ) );
+    }
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( jump_consistent_hash( keys[ i ], 1 ), 0 );
+    }
+
+    std::vector<std::int32_t> prev( N, 0 );
+
+    for( std::int32_t n = 2; n <= B; ++n )
+    {
+        std::size_t moved = 0;
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            std::int32_t b = jump_consistent_hash( keys[ i ], n );
+
+            BOOST_TEST_GE( b, 0 );
+            BOOST_TEST_LT( b, n );
+
+            // a key either stays, or moves to the new bucket
+
+            if( b != prev[ i ] )
+            {
+                BOOST_TEST_EQ( b, n - 1 );
+                ++moved;
+            }
+
+            prev[ i ] = b;
+        }
+
+        // about N / n keys move
+
+        BOOST_TEST_GT( moved, N / n / 2 );
+        BOOST_TEST_LT( moved, N / n * 2 );
+    }
+
+    // balance
+
+    std::vector<std::size_t> count( B );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        ++count[ jump_consistent_hash( keys[ i ], B ) ];
+    }
+
+    for( std::int32_t b = 0; b < B; ++b )
+    {
+        BOOST_TEST_GT( count[ b ], N / B / 2 );
+        BOOST_TEST_LT( count[ b ], N / B * 2 );
+    }
+}
+
+template<class Hash> void test_rendezvous()
+{
+    using rh = boost::hash2::rendezvous_hash<std::string, Hash>;
+
+    std::size_t const M = 20;
+    std::size_t const N = 10000;
+
+    rh r;
+
+    BOOST_TEST( r.empty() );
+
+    for( std::size_t j = 0; j < M; ++j )
+    {
+        r.insert( "node" + std::to_string( j ) );
+    }
+
+    BOOST_TEST_EQ( r.size(), M );
+
+    std::vector<std::string> before( N );
+    std::vector<std::size_t> count( M );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        std::size_t j = r.select_index( i );
+
+        BOOST_TEST_LT( j, M );
+        BOOST_TEST_EQ( r.select( i ), r.node( j ) );
+
+        before[ i ] = r.select( i );
+        ++count[ j ];
+    }
+
+    for( std::size_t j = 0; j < M; ++j )
+    {
+        BOOST_TEST_GT( count[ j ], N / M / 2 );
+        BOOST_TEST_LT( count[ j ], N / M * 2 );
+    }
+
+    // adding a node moves keys only to it
+
+    r.insert( "node" + std::to_string( M ) );
+
+    {
+        std::size_t moved = 0;
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            std::string const& s = r.select( i );
+
+            if( s != before[ i ] )
+            {
+                BOOST_TEST_EQ( s, "node" + std::to_string( M ) );
+                ++moved;
+            }
+        }
+
+        BOOST_TEST_GT( moved, N / ( M + 1 ) / 2 );
+        BOOST_TEST_LT( moved, N / ( M + 1 ) * 2 );
+    }
+
+    // removing it restores the previous assignment
+
+    BOOST_TEST( r.erase( "node" + std::to_string( M ) ) );
+    BOOST_TEST( !r.erase( "node" + std::to_string( M ) ) );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( r.select( i ), before[ i ] );
+    }
+
+    // removing a node moves only its keys
+
+    BOOST_TEST( r.erase( "node3" ) );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        std::string const& s = r.select( i );
+
+        BOOST_TEST_NE( s, "node3" );
+
+        if( before[ i ] != "node3" )
+        {
+            BOOST_TEST_EQ( s, before[ i ] );
+        }
+    }
+
+    r.insert( "node3" );
+
+    // top r
+
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        std::size_t ix[ M + 1 ];
+
+        std::size_t* p = r.select_n( i, 3, ix );
+
+        BOOST_TEST_EQ( p - ix, 3 );
+        BOOST_TEST_EQ( ix[ 0 ], r.select_index( i ) );
+        BOOST_TEST_NE( ix[ 0 ], ix[ 1 ] );
+        BOOST_TEST_NE( ix[ 0 ], ix[ 2 ] );
+        BOOST_TEST_NE( ix[ 1 ], ix[ 2 ] );
+
+        // a larger r extends the smaller one
+
+        std::size_t* q = r.select_n( i, M + 1, ix );
+
+        BOOST_TEST_EQ( q - ix, M );
+        BOOST_TEST_EQ( ix[ 0 ], r.select_index( i ) );
+
+        std::size_t iy[ 3 ];
+        r.select_n( i, 3, iy );
+
+        BOOST_TEST( std::equal( iy, iy + 3, ix ) );
+
+        std::sort( ix, ix + M );
+        BOOST_TEST( std::unique( ix, ix + M ) == ix + M );
+    }
+
+    r.clear();
+    BOOST_TEST( r.empty() );
+
+    {
+        std::size_t ix[ 1 ];
+        BOOST_TEST( r.select_n( 1, 1, ix ) == ix );
+    }
+}
+
+template<class Hash> void test_weighted()
+{
+    using rh = boost::hash2::rendezvous_hash<int, Hash>;
+
+    rh r;
+
+    r.insert( 0, 1.0 );
+    r.insert( 1, 2.0 );
+    r.insert( 2, 1.0 );
+    r.insert( 3, 4.0 );
+
+    std::size_t const N = 80000;
+
+    std::size_t count[ 4 ] = {};
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        ++count[ r.select( i ) ];
+    }
+
+    // the keys are assigned in proportion to the weights
+
+    BOOST_TEST_GT( count[ 0 ], N / 8 * 9 / 10 );
+    BOOST_TEST_LT( count[ 0 ], N / 8 * 11 / 10 );
+    BOOST_TEST_GT( count[ 1 ], N / 4 * 9 / 10 );
+    BOOST_TEST_LT( count[ 1 ], N / 4 * 11 / 10 );
+    BOOST_TEST_GT( count[ 2 ], N / 8 * 9 / 10 );
+    BOOST_TEST_LT( count[ 2 ], N / 8 * 11 / 10 );
+    BOOST_TEST_GT( count[ 3 ], N / 2 * 9 / 10 );
+    BOOST_TEST_LT( count[ 3 ], N / 2 * 11 / 10 );
+
+    // equal weights other than 1 select the same nodes as weight 1
+
+    rh r1, r2;
+
+    for( int j = 0; j < 10; ++j )
+    {
+        r1.insert( j );
+        r2.insert( j, 3.5 );
+    }
+
+    rh r3( r1 );
+
+    r3.insert( 10, 2.0 );
+    r3.erase( 10 );
+
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST_EQ( r1.select( i ), r2.select( i ) );
+        BOOST_TEST_EQ( r1.select( i ), r3.select( i ) );
+    }
+}
+
+template<class Hash> void test_seed()
+{
+    using rh = boost::hash2::rendezvous_hash<int, Hash>;
+
+    rh r1, r2( 0 ), r3( 7 );
+
+    for( int j = 0; j < 16; ++j )
+    {
+        r1.insert( j );
+        r2.insert( j );
+        r3.insert( j );
+    }
+
+    std::size_t differ = 0;
+
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST_EQ( r1.select( i ), r2.select( i ) );
+        differ += r1.select( i ) != r3.select( i );
+    }
+
+    BOOST_TEST_GT( differ, 800u );
+}
+
+int main()
+{
+    test_jump();
+
+    test_rendezvous<boost::hash2::xxhash_64>();
+    test_rendezvous<boost::hash2::siphash_64>();
+
+    test_weighted<boost::hash2::xxhash_64>();
+    test_weighted<boost::hash2::siphash_64>();
+
+    test_seed<boost::hash2::xxhash_64>();
+    test_seed<boost::hash2::siphash_64>();
+
+    return boost::report_errors();
+}
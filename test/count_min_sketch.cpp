@@ -0,0 +1,293 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/count_min_sketch.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cstddef>
+
+// a skewed stream: key i occurs 1000 / (i + 1) times
+
+static std::vector<std::string> make_stream( std::map<std::string, int>& freq )
+{
+    std::vector<std::string> v;
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        std::string k = "key_" + std::to_string( i );
+        int n = 1000 / ( i + 1 );
+
+        freq[ k ] = n;
+
+        for( int j = 0; j < n; ++j )
+        {
+            v.push_back( k );
+        }
+    }
+
+    // interleave the occurrences
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        std::size_t j = ( i * 7919 ) % v.size();
+        std::swap( v[ i ], v[ j ] );
+    }
+
+    return v;
+}
+
+template<class S> std::vector<unsigned char> serialize( S const& s )
+{
+    std::vector<unsigned char> w( s.byte_size() );
+    s.serialize( w.data() );
+
+    return w;
+}
+
+// deserializes the data of s into s2; returns whether that succeeded,
+// checking that s2 is unchanged when it didn't
+
+template<class S, class S2> bool test_deserialize( S const& s, S2 s2, bool accept )
+{
+    std::vector<unsigned char> w = serialize( s );
+    std::vector<unsigned char> w2 = serialize( s2 );
+
+    bool r = s2.deserialize( w.data(), w.size() );
+
+    BOOST_TEST( serialize( s2 ) == ( r? w: w2 ) );
+
+    return r == accept;
+}
+
+// common behavior; over is true for the sketches that never underestimate
+
+template<class S> void test( S const& s0, bool over, long tolerance )
+{
+    std::map<std::string, int> freq;
+    std::vector<std::string> v = make_stream( freq );
+
+    S s1( s0 ), s2( s0 ), s3( s0 ), s4( s0 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        s1.insert( v[ i ] );
+        s3.add_atomic( v[ i ], 1 );
+    }
+
+    s2.insert( v.begin(), v.end() );
+
+    BOOST_TEST( serialize( s1 ) == serialize( s2 ) );
+    BOOST_TEST( serialize( s1 ) == serialize( s3 ) );
+
+    for( std::map<std::string, int>::const_iterator it = freq.begin(); it != freq.end(); ++it )
+    {
+        long e = static_cast<long>( s1.estimate( it->first ) );
+
+        if( over )
+        {
+            BOOST_TEST_GE( e, it->second );
+        }
+
+        BOOST_TEST_LE( std::abs( e - it->second ), tolerance );
+    }
+
+    // batched estimates
+
+    {
+        std::vector<std::string> keys;
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            keys.push_back( "key_" + std::to_string( i ) );
+        }
+
+        std::vector<long> r;
+        s1.estimate( keys.begin(), keys.end(), std::back_inserter( r ) );
+
+        BOOST_TEST_EQ( r.size(), keys.size() );
+
+        for( std::size_t i = 0; i < keys.size(); ++i )
+        {
+            BOOST_TEST_EQ( r[ i ], static_cast<long>( s1.estimate( keys[ i ] ) ) );
+        }
+    }
+
+    // merge of two halves
+
+    {
+        S a( s0 ), b( s0 );
+
+        a.insert( v.begin(), v.begin() + v.size() / 2 );
+        b.insert( v.begin() + v.size() / 2, v.end() );
+
+        a.merge( b );
+
+        for( std::map<std::string, int>::const_iterator it = freq.begin(); it != freq.end(); ++it )
+        {
+            long e = static_cast<long>( a.estimate( it->first ) );
+
+            if( over )
+            {
+                BOOST_TEST_GE( e, it->second );
+            }
+        }
+    }
+
+    // add
+
+    {
+        S a( s0 );
+
+        a.add( "x", 5 );
+        a.add( "x", 7 );
+        a.add_atomic( "x", 3 );
+
+        BOOST_TEST_EQ( static_cast<long>( a.estimate( "x" ) ), 15 );
+        BOOST_TEST_EQ( static_cast<long>( a.estimate( "y" ) ), 0 );
+    }
+
+    // serialization, copy
+
+    {
+        std::vector<unsigned char> w = serialize( s1 );
+
+        BOOST_TEST( s4.deserialize( w.data(), w.size() ) );
+        BOOST_TEST( serialize( s4 ) == w );
+
+        // truncated or corrupted input is rejected, leaving s4 unchanged
+
+        BOOST_TEST( !s4.deserialize( w.data(), 0 ) );
+        BOOST_TEST( !s4.deserialize( w.data(), 16 ) );
+        BOOST_TEST( !s4.deserialize( w.data(), w.size() - 1 ) );
+
+        for( std::size_t i = 0; i < 24; i += 4 )
+        {
+            std::vector<unsigned char> w2( w );
+            w2[ i ] ^= 1;
+
+            BOOST_TEST( !s4.deserialize( w2.data(), w2.size() ) );
+        }
+
+        BOOST_TEST( serialize( s4 ) == w );
+
+        S s5( s1 );
+        BOOST_TEST( serialize( s5 ) == w );
+
+        s4.clear();
+        BOOST_TEST_EQ( static_cast<long>( s4.estimate( "key_0" ) ), 0 );
+
+        s4 = s1;
+        BOOST_TEST( serialize( s4 ) == w );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // 1000 distinct keys, 7485 occurrences
+
+    test( count_min_sketch<std::string, xxhash_64>( 2048, 4 ), true, 30 );
+    test( count_min_sketch<std::string, siphash_64, std::uint64_t>( 2048, 4, 7 ), true, 30 );
+    test( conservative_count_min_sketch<std::string, xxhash_64>( 2048, 4, "seed", 4 ), true, 15 );
+    test( count_sketch<std::string, xxhash_64>( 2048, 5 ), false, 30 );
+    test( count_sketch<std::string, siphash_64, std::int64_t, big_endian_flavor>( 2048, 4, 7 ), false, 30 );
+
+    // deep sketches take the row indices from more than one 64 bit word
+
+    test( count_min_sketch<std::string, xxhash_64>( 1u << 16, 16 ), true, 2 );
+    test( count_sketch<std::string, xxhash_64>( 1u << 16, 15 ), false, 2 );
+
+    {
+        count_min_sketch<int, xxhash_64> s( 1000, 3 );
+
+        BOOST_TEST_EQ( s.width(), 1024 );
+        BOOST_TEST_EQ( s.depth(), 3 );
+        BOOST_TEST_EQ( s.byte_size(), 24 + 1024 * 3 * 4 );
+    }
+
+    // sketches with different dimensions, counters or seeds reject each other's data
+
+    {
+        count_min_sketch<int, xxhash_64> s( 1024, 3 );
+        s.add( 1, 5 );
+
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64>( 1024, 3 ), true ) );
+        BOOST_TEST( test_deserialize( s, conservative_count_min_sketch<int, xxhash_64>( 1024, 3 ), true ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64>( 2048, 3 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64>( 1024, 4 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64>( 1024, 3, 7 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, siphash_64>( 1024, 3 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64, std::uint16_t>( 1024, 3 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64, std::uint64_t>( 1024, 3 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_sketch<int, xxhash_64>( 1024, 3 ), false ) );
+    }
+
+    {
+        count_sketch<int, xxhash_64> s( 1024, 3 );
+        s.add( 1, -5 );
+
+        BOOST_TEST( test_deserialize( s, count_sketch<int, xxhash_64>( 1024, 3 ), true ) );
+        BOOST_TEST( test_deserialize( s, count_sketch<int, xxhash_64>( 1024, 3, "seed", 4 ), false ) );
+        BOOST_TEST( test_deserialize( s, count_min_sketch<int, xxhash_64>( 1024, 3 ), false ) );
+    }
+
+    // unsigned counters saturate
+
+    {
+        count_min_sketch<int, xxhash_64, std::uint8_t> s1( 64, 4 ), s2( 64, 4 );
+
+        s1.add( 1, 200 );
+        s1.add( 1, 100 );
+
+        BOOST_TEST_EQ( s1.estimate( 1 ), 255 );
+
+        s2.add_atomic( 1, 200 );
+        s2.add_atomic( 1, 100 );
+
+        BOOST_TEST_EQ( s2.estimate( 1 ), 255 );
+
+        s1.merge( s2 );
+
+        BOOST_TEST_EQ( s1.estimate( 1 ), 255 );
+    }
+
+    {
+        conservative_count_min_sketch<int, xxhash_64, std::uint8_t> s1( 64, 4 ), s2( 64, 4 );
+
+        s1.add( 1, 200 );
+        s1.add( 1, 100 );
+
+        BOOST_TEST_EQ( s1.estimate( 1 ), 255 );
+
+        s2.add_atomic( 1, 200 );
+        s2.add_atomic( 1, 100 );
+
+        BOOST_TEST_EQ( s2.estimate( 1 ), 255 );
+    }
+
+    // signed counters wrap around; the minimum value negates to itself
+
+    {
+        count_sketch<int, xxhash_64, std::int8_t> s1( 64, 5 ), s2( 64, 5 );
+
+        s1.add( 1, -128 );
+        BOOST_TEST_EQ( s1.estimate( 1 ), -128 );
+
+        s2.add_atomic( 1, -128 );
+        BOOST_TEST_EQ( s2.estimate( 1 ), -128 );
+
+        s1.add( 1, 100 );
+        s1.add( 1, 100 );
+
+        BOOST_TEST_EQ( s1.estimate( 1 ), 72 );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,145 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fastcdc.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// straightforward FastCDC over a complete buffer, for comparison
+
+static std::size_t cut_point( unsigned char const* p, std::size_t n, std::size_t min, std::size_t avg, std::size_t max )
+{
+    boost::hash2::gear_64 g;
+
+    int bits = 0;
+    for( std::size_t a = avg; a > 1; a >>= 1 ) ++bits;
+
+    std::uint64_t mask_s = ~std::uint64_t( 0 ) << ( 64 - ( bits + 2 ) );
+    std::uint64_t mask_l = ~std::uint64_t( 0 ) << ( 64 - ( bits - 2 ) );
+
+    if( n <= min ) return n;
+    if( n > max ) n = max;
+
+    std::size_t normal = avg < n? avg: n;
+
+    std::size_t i = min;
+
+    for( ; i < normal; ++i )
+    {
+        g.push( p[ i ] );
+        if( ( g.value() & mask_s ) == 0 ) return i + 1;
+    }
+
+    for( ; i < n; ++i )
+    {
+        g.push( p[ i ] );
+        if( ( g.value() & mask_l ) == 0 ) return i + 1;
+    }
+
+    return n;
+}
+
+template<class H> void test( std::vector<unsigned char> const& v, std::size_t min, std::size_t avg, std::size_t max )
+{
+    using chunker = boost::hash2::fastcdc<H>;
+    using chunk = typename chunker::chunk;
+
+    std::vector<chunk> r1;
+
+    {
+        std::size_t offset = 0;
+
+        while( offset < v.size() )
+        {
+            std::size_t k = cut_point( v.data() + offset, v.size() - offset, min, avg, max );
+
+            H h;
+            h.update( v.data() + offset, k );
+
+            chunk c = { offset, k, h.result() };
+            r1.push_back( c );
+
+            offset += k;
+        }
+    }
+
+    std::size_t const steps[] = { 1, 7, 64, 1000, 4096, v.size() };
+
+    for( std::size_t step: steps )
+    {
+        chunker cdc( min, avg, max );
+
+        std::vector<chunk> r2;
+        auto f = [&]( chunk const& c ){ r2.push_back( c ); };
+
+        for( std::size_t i = 0; i < v.size(); i += step )
+        {
+            std::size_t k = v.size() - i < step? v.size() - i: step;
+            cdc.update( v.data() + i, k, f );
+        }
+
+        cdc.finish( f );
+
+        BOOST_TEST_EQ( cdc.offset(), v.size() );
+
+        if( BOOST_TEST_EQ( r1.size(), r2.size() ) )
+        {
+            for( std::size_t i = 0; i < r1.size(); ++i )
+            {
+                BOOST_TEST_EQ( r1[ i ].offset, r2[ i ].offset );
+                BOOST_TEST_EQ( r1[ i ].size, r2[ i ].size );
+                BOOST_TEST( r1[ i ].digest == r2[ i ].digest );
+            }
+        }
+    }
+
+    for( std::size_t i = 0; i < r1.size(); ++i )
+    {
+        BOOST_TEST_LE( r1[ i ].size, max );
+
+        if( i + 1 < r1.size() )
+        {
+            BOOST_TEST_GE( r1[ i ].size, min );
+        }
+    }
+}
+
+int main()
+{
+    std::vector<unsigned char> v( 256 * 1024 );
+
+    std::uint64_t x = 0;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( boost::hash2::detail::splitmix64( x ) >> 56 );
+    }
+
+    test<boost::hash2::xxhash_64>( v, 2048, 8192, 65536 );
+    test<boost::hash2::sha2_256>( v, 2048, 8192, 65536 );
+    test<boost::hash2::sha2_256>( v, 256, 1024, 4096 );
+    test<boost::hash2::xxhash_64>( v, 64, 64, 64 );
+
+    // low-entropy input reaches max_size
+
+    std::vector<unsigned char> z( 100000 );
+    test<boost::hash2::xxhash_64>( z, 1024, 4096, 16384 );
+
+    // empty input produces no chunks
+
+    {
+        boost::hash2::fastcdc<boost::hash2::xxhash_64> cdc( 64, 256, 1024 );
+
+        int k = 0;
+        cdc.finish( [&]( boost::hash2::fastcdc<boost::hash2::xxhash_64>::chunk const& ){ ++k; } );
+
+        BOOST_TEST_EQ( k, 0 );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,151 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <list>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, class T> std::size_t reference_value( H h, T const& v )
+{
+    boost::hash2::hash_append( h, {}, v );
+    return boost::hash2::get_integral_result<std::size_t>( h );
+}
+
+template<class H> void test()
+{
+    using boost::hash2::hash;
+
+    BOOST_TEST( (hash<int, H>::is_avalanching::value) );
+    BOOST_TEST( (hash<std::string, H>::is_avalanching::value) );
+
+    // non-contiguous keys are hashed with hash_append
+
+    {
+        hash<int, H> h1;
+
+        BOOST_TEST_EQ( h1( 5 ), reference_value( H(), 5 ) );
+
+        std::list<int> v{ 1, 2, 3 };
+
+        hash<std::list<int>, H> h2( 7 );
+
+        BOOST_TEST_EQ( h2( v ), reference_value( H( 7 ), v ) );
+
+        std::pair<int, std::string> p( 1, "x" );
+
+        hash<std::pair<int, std::string>, H> h3;
+
+        BOOST_TEST_EQ( h3( p ), reference_value( H(), p ) );
+    }
+
+    // contiguous keys are hashed as their elements, without the size
+
+    {
+        std::string s( "hash2" );
+        std::vector<char> v( s.begin(), s.end() );
+
+        hash<std::string, H> h1;
+        hash<std::vector<char>, H> h2;
+
+        H h;
+        h.update( s.data(), s.size() );
+
+        BOOST_TEST_EQ( h1( s ), boost::hash2::get_integral_result<std::size_t>( h ) );
+        BOOST_TEST_EQ( h1( s ), h2( v ) );
+
+        std::vector<std::uint32_t> w{ 1, 2, 3 };
+
+        hash<std::vector<std::uint32_t>, H> h3;
+
+        H h4;
+        boost::hash2::hash_append_range( h4, {}, w.data(), w.data() + w.size() );
+
+        BOOST_TEST_EQ( h3( w ), boost::hash2::get_integral_result<std::size_t>( h4 ) );
+    }
+
+    // the seeds
+
+    {
+        unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+        std::string s( "seeded" );
+
+        hash<std::string, H> h1( 0x0102030405060708ull );
+        hash<std::string, H> h2( H( 0x0102030405060708ull ) );
+        hash<std::string, H> h3( seed, sizeof( seed ) );
+        hash<std::string, H> h4( static_cast<void const*>( seed ), sizeof( seed ) );
+        hash<std::string, H> h5( H( seed, sizeof( seed ) ) );
+        hash<std::string, H> h6;
+        hash<std::string, H> h7( 0 );
+
+        BOOST_TEST_EQ( h1( s ), h2( s ) );
+        BOOST_TEST_EQ( h3( s ), h4( s ) );
+        BOOST_TEST_EQ( h3( s ), h5( s ) );
+        BOOST_TEST_EQ( h6( s ), h7( s ) );
+
+        BOOST_TEST_NE( h1( s ), h6( s ) );
+        BOOST_TEST_NE( h3( s ), h6( s ) );
+    }
+
+    // containers
+
+    {
+        using set_type = std::unordered_set<std::string, hash<std::string, H>>;
+
+        set_type s( 0, hash<std::string, H>( 12345 ) );
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            s.insert( std::to_string( i ) );
+        }
+
+        BOOST_TEST_EQ( s.size(), 1000u );
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            BOOST_TEST_EQ( s.count( std::to_string( i ) ), 1u );
+        }
+
+        BOOST_TEST_EQ( s.count( "1000" ), 0u );
+
+        using map_type = std::unordered_map<std::uint64_t, int, hash<std::uint64_t, H>>;
+
+        map_type m;
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            m[ static_cast<std::uint64_t>( i ) << 32 ] = i;
+        }
+
+        BOOST_TEST_EQ( m.size(), 1000u );
+        BOOST_TEST_EQ( m[ std::uint64_t( 500 ) << 32 ], 500 );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::sha2_256>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,113 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, class K> void test( std::vector<K> const& keys, std::uint64_t seed )
+{
+    using R = typename H::result_type;
+
+    std::vector<R> r1;
+
+    for( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        H h( seed );
+        h.update( keys[ i ].data(), keys[ i ].size() );
+
+        r1.push_back( h.result() );
+    }
+
+    {
+        std::vector<R> r2( keys.size() );
+
+        auto it = boost::hash2::hash_batch<H>( keys, r2.begin(), seed );
+
+        BOOST_TEST( it == r2.end() );
+        BOOST_TEST( r1 == r2 );
+    }
+
+    {
+        std::vector<R> r2;
+        std::list<K> keys2( keys.begin(), keys.end() );
+
+        boost::hash2::hash_batch<H>( keys2, std::back_inserter( r2 ), seed );
+
+        BOOST_TEST( r1 == r2 );
+    }
+
+    if( seed == 0 )
+    {
+        std::vector<R> r2;
+        boost::hash2::hash_batch<H>( keys, std::back_inserter( r2 ) );
+
+        BOOST_TEST( r1 == r2 );
+    }
+}
+
+template<class H> void test( std::uint64_t seed )
+{
+    std::vector<std::string> v1;
+    std::vector< std::vector<unsigned char> > v2;
+
+    for( std::size_t i = 0; i < 150; ++i )
+    {
+        std::string s;
+
+        for( std::size_t j = 0; j < i; ++j )
+        {
+            s.push_back( static_cast<char>( 'a' + ( i * 7 + j * 13 ) % 26 ) );
+        }
+
+        v1.push_back( s );
+        v2.push_back( std::vector<unsigned char>( s.begin(), s.end() ) );
+    }
+
+    // vary the order, so that lockstep groups have different lengths
+    for( std::size_t i = 0; i < v1.size(); i += 3 )
+    {
+        std::swap( v1[ i ], v1[ v1.size() - 1 - i ] );
+    }
+
+    test<H>( v1, seed );
+    test<H>( v2, seed );
+
+    // batches that are not a multiple of four
+
+    for( std::size_t n = 0; n < 8; ++n )
+    {
+        test<H>( std::vector<std::string>( v1.begin(), v1.begin() + n ), seed );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    std::uint64_t const seeds[] = { 0, 1, 0x0102030405060708ull };
+
+    for( std::uint64_t seed: seeds )
+    {
+        test<fnv1a_32>( seed );
+        test<fnv1a_64>( seed );
+        test<xxhash_32>( seed );
+        test<xxhash_64>( seed );
+        test<xxh3_128>( seed );
+        test<siphash_32>( seed );
+        test<siphash_64>( seed );
+        test<sha2_256>( seed );
+    }
+
+    return boost::report_errors();
+}
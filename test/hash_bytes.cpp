@@ -0,0 +1,69 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_bytes.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash_streaming( unsigned char const* p, std::size_t n, std::uint64_t seed )
+{
+    H h( seed );
+
+    h.update( p, n );
+
+    return h.result();
+}
+
+template<class H> void test( std::uint64_t seed )
+{
+    std::vector<unsigned char> v( 1100 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 7 + i / 251 );
+    }
+
+    for( std::size_t n = 0; n <= v.size(); n += ( n < 300? 1: 37 ) )
+    {
+        auto r = hash_streaming<H>( v.data(), n, seed );
+
+        BOOST_TEST( boost::hash2::hash_bytes<H>( v.data(), n, seed ) == r );
+        BOOST_TEST( boost::hash2::hash_bytes<H>( static_cast<void const*>( v.data() ), n, seed ) == r );
+
+        if( seed == 0 )
+        {
+            BOOST_TEST( boost::hash2::hash_bytes<H>( v.data(), n ) == r );
+            BOOST_TEST( boost::hash2::hash_bytes<H>( static_cast<void const*>( v.data() ), n ) == r );
+        }
+    }
+}
+
+template<class H> void test()
+{
+    test<H>( 0 );
+    test<H>( 1 );
+    test<H>( 0x9e3779b185ebca8dull );
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_512>();
+
+    return boost::report_errors();
+}
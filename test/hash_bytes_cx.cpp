@@ -0,0 +1,73 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_bytes.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR) || ( defined(BOOST_GCC) && BOOST_GCC < 60000 )
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX14_CONSTEXPR is defined" )
+int main() {}
+
+#else
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+template<class H, std::size_t N> constexpr typename H::result_type hash_streaming( unsigned char const (&v)[ N ], std::size_t n, std::uint64_t seed )
+{
+    H h( seed );
+
+    h.update( v, n );
+
+    return h.result();
+}
+
+template<class H, std::size_t N> constexpr bool test( unsigned char const (&v)[ N ], std::uint64_t seed )
+{
+    for( std::size_t n = 0; n <= N; ++n )
+    {
+        if( !( boost::hash2::hash_bytes<H>( v, n, seed ) == hash_streaming<H>( v, n, seed ) ) ) return false;
+    }
+
+    return true;
+}
+
+constexpr unsigned char v[ 72 ] =
+{
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40,
+    0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+};
+
+int main()
+{
+    using namespace boost::hash2;
+
+    STATIC_ASSERT( test<xxhash_64>( v, 0 ) );
+    STATIC_ASSERT( test<xxhash_64>( v, 7 ) );
+
+    STATIC_ASSERT( test<xxh3_128>( v, 0 ) );
+    STATIC_ASSERT( test<xxh3_128>( v, 7 ) );
+
+    STATIC_ASSERT( test<siphash_64>( v, 0 ) );
+    STATIC_ASSERT( test<siphash_64>( v, 7 ) );
+
+    STATIC_ASSERT( test<sha2_256>( v, 0 ) );
+    STATIC_ASSERT( test<sha2_256>( v, 7 ) );
+}
+
+#endif
@@ -0,0 +1,130 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hashed.hpp>
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_set>
+
+template<class T, class Hash, class Flavor> typename Hash::result_type digest_of( T const& v )
+{
+    Hash h;
+    boost::hash2::hash_append( h, Flavor(), v );
+
+    return h.result();
+}
+
+template<class H, class Hash, class Flavor> void test( std::string const& s )
+{
+    using boost::hash2::hashed;
+
+    hashed<std::string, Hash, Flavor> x( s );
+
+    BOOST_TEST_EQ( x.get(), s );
+    BOOST_TEST( x.digest() == ( digest_of<std::string, Hash, Flavor>( s ) ) );
+
+    // only the digest is appended, under the outer flavor
+
+    {
+        H h1, h2;
+
+        boost::hash2::hash_append( h1, boost::hash2::big_endian_flavor(), x );
+        boost::hash2::hash_append( h2, boost::hash2::big_endian_flavor(), x.digest() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        H h1, h2;
+
+        boost::hash2::hash_append( h1, boost::hash2::little_endian_flavor(), x );
+        boost::hash2::hash_append( h2, boost::hash2::little_endian_flavor(), x.digest() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // as a member of a composite type
+
+    {
+        std::vector< std::pair<int, hashed<std::string, Hash, Flavor>> > v;
+
+        v.push_back( std::make_pair( 1, x ) );
+        v.push_back( std::make_pair( 2, hashed<std::string, Hash, Flavor>( s + s ) ) );
+
+        H h1, h2;
+        Flavor f;
+
+        boost::hash2::hash_append( h1, f, v );
+
+        boost::hash2::hash_append( h2, f, 1 );
+        boost::hash2::hash_append( h2, f, x.digest() );
+        boost::hash2::hash_append( h2, f, 2 );
+        boost::hash2::hash_append( h2, f, ( digest_of<std::string, Hash, Flavor>( s + s ) ) );
+        boost::hash2::hash_append_size( h2, f, 2 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+template<class H> void test()
+{
+    using namespace boost::hash2;
+
+    std::string const v[] = { "", "a", "abc", std::string( 1000, 'x' ) };
+
+    for( auto const& s: v )
+    {
+        test<H, fnv1a_32, default_flavor>( s );
+        test<H, fnv1a_64, little_endian_flavor>( s );
+        test<H, xxhash_64, big_endian_flavor>( s );
+        test<H, sha2_256, default_flavor>( s );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_64>();
+
+    // comparisons
+
+    {
+        using X = hashed<std::string, xxhash_64>;
+
+        X x1( std::string( "abc" ) ), x2( std::string( "abc" ) ), x3( std::string( "abd" ) );
+
+        BOOST_TEST( x1 == x2 );
+        BOOST_TEST_NOT( x1 != x2 );
+
+        BOOST_TEST( x1 != x3 );
+        BOOST_TEST_NOT( x1 == x3 );
+    }
+
+    // as a key of an unordered container
+
+    {
+        using X = hashed<std::string, sha2_256>;
+
+        std::unordered_set< X, boost::hash2::hash<X, xxhash_64> > s;
+
+        s.insert( X( std::string( "abc" ) ) );
+        s.insert( X( std::string( "def" ) ) );
+        s.insert( X( std::string( "abc" ) ) );
+
+        BOOST_TEST_EQ( s.size(), 2u );
+        BOOST_TEST_EQ( s.count( X( std::string( "def" ) ) ), 1u );
+        BOOST_TEST_EQ( s.count( X( std::string( "ghi" ) ) ), 0u );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,262 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hyperloglog.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+template<class S> void test_accuracy( S s, double tolerance )
+{
+    double const n[] = { 0, 1, 10, 100, 1000, 10000, 100000, 300000 };
+
+    std::uint64_t i = 0;
+
+    for( double x: n )
+    {
+        for( ; static_cast<double>( i ) < x; ++i )
+        {
+            s.insert( i );
+            s.insert( i ); // duplicates don't count
+        }
+
+        double e = s.estimate();
+
+        BOOST_TEST_LE( std::abs( e - x ), tolerance * x + 0.5 );
+    }
+}
+
+template<class S> std::vector<unsigned char> serialize( S const& s )
+{
+    std::vector<unsigned char> w( s.serialized_size() );
+    BOOST_TEST_EQ( s.serialize( w.data() ), w.size() );
+
+    return w;
+}
+
+template<class S> void test_roundtrip( S const& s )
+{
+    std::vector<unsigned char> w = serialize( s );
+
+    S s2;
+    BOOST_TEST( s2.deserialize( w.data(), w.size() ) );
+
+    // a sparse sketch above the sparse limit is written as dense
+    BOOST_TEST_EQ( s2.is_sparse(), w[ 0 ] == 1 );
+    BOOST_TEST_EQ( s2.estimate(), s.estimate() );
+    BOOST_TEST( serialize( s2 ) == w );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // relative standard error is 1.04 / sqrt(m); allow five of them
+
+    test_accuracy( hyperloglog<std::uint64_t, xxhash_64>(), 5 * 1.04 / 128 );
+    test_accuracy( hyperloglog<std::uint64_t, siphash_64, 12>( 7 ), 5 * 1.04 / 64 );
+    test_accuracy( hyperloglog<std::uint64_t, xxhash_64, 16, big_endian_flavor>( "seed", 4 ), 5 * 1.04 / 256 );
+
+    // sparse to dense, batched insert
+
+    {
+        hyperloglog<std::string, xxhash_64> s1, s2;
+
+        std::vector<std::string> v;
+
+        for( int i = 0; i < 20000; ++i )
+        {
+            v.push_back( "key_" + std::to_string( i ) );
+        }
+
+        BOOST_TEST( s1.is_sparse() );
+        BOOST_TEST_EQ( s1.estimate(), 0 );
+
+        test_roundtrip( s1 );
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            s1.insert( v[ i ] );
+        }
+
+        s2.insert( v.begin(), v.begin() + 1000 );
+
+        BOOST_TEST( s1.is_sparse() );
+        BOOST_TEST_EQ( s1.estimate(), s2.estimate() );
+        BOOST_TEST( serialize( s1 ) == serialize( s2 ) );
+
+        test_roundtrip( s1 );
+
+        // sparse into dense and dense into sparse merges agree
+
+        {
+            hyperloglog<std::string, xxhash_64> s3, s4;
+
+            s3.insert( v.begin(), v.begin() + 1000 );
+            s4.insert( v.begin() + 1000, v.end() );
+
+            BOOST_TEST( s3.is_sparse() );
+            BOOST_TEST( !s4.is_sparse() );
+
+            hyperloglog<std::string, xxhash_64> s5( s3 ), s6( s4 );
+
+            s5.merge( s4 );
+            s6.merge( s3 );
+
+            BOOST_TEST( !s5.is_sparse() );
+            BOOST_TEST( serialize( s5 ) == serialize( s6 ) );
+
+            s4.clear();
+
+            BOOST_TEST( s4.is_sparse() );
+            BOOST_TEST_EQ( s4.estimate(), 0 );
+
+            s3.merge( s4 );
+
+            BOOST_TEST( s3.is_sparse() );
+            BOOST_TEST_EQ( s3.estimate(), s1.estimate() );
+        }
+
+        s1.insert( v.begin() + 1000, v.end() );
+        s2.insert( v.begin() + 1000, v.end() );
+
+        BOOST_TEST( !s1.is_sparse() );
+        BOOST_TEST_EQ( s1.estimate(), s2.estimate() );
+        BOOST_TEST( serialize( s1 ) == serialize( s2 ) );
+
+        test_roundtrip( s1 );
+
+        BOOST_TEST_LE( std::abs( s1.estimate() - 20000 ), 20000 * 5 * 1.04 / 128 );
+
+        // merge equals the union
+
+        for( int k: { 0, 10, 1000, 5000, 20000 } )
+        {
+            for( int l: { 0, 10, 1000, 5000, 20000 } )
+            {
+                hyperloglog<std::string, xxhash_64> a, b;
+
+                a.insert( v.begin(), v.begin() + k );
+                b.insert( v.end() - l, v.end() );
+
+                a.merge( b );
+
+                hyperloglog<std::string, xxhash_64> c;
+
+                c.insert( v.begin(), v.begin() + k );
+                c.insert( v.end() - l, v.end() );
+
+                BOOST_TEST_EQ( a.estimate(), c.estimate() );
+
+                if( a.is_sparse() == c.is_sparse() )
+                {
+                    BOOST_TEST( serialize( a ) == serialize( c ) );
+                }
+            }
+        }
+    }
+
+    // round trip around the sparse limit of m / 4 distinct registers,
+    // before the unsorted entries are compacted
+
+    {
+        hyperloglog<int, xxhash_64, 4> s;
+
+        for( int i = 0; i < 64; ++i )
+        {
+            s.insert( i );
+            test_roundtrip( s );
+        }
+    }
+
+    {
+        hyperloglog<int, xxhash_64> s;
+
+        std::size_t const limit = ( std::size_t( 1 ) << 14 ) / 4;
+        std::size_t const dense_size = 2 + limit * 3;
+
+        bool below = false, above = false;
+
+        for( int i = 1; i <= 6000; ++i )
+        {
+            s.insert( i );
+
+            std::size_t n = s.serialized_size();
+
+            if( n == 6 + 3 * limit )
+            {
+                below = true;
+                test_roundtrip( s );
+            }
+            else if( n == dense_size && !above )
+            {
+                above = true;
+                test_roundtrip( s );
+            }
+            else if( i % 1000 == 0 )
+            {
+                test_roundtrip( s );
+            }
+        }
+
+        BOOST_TEST( below );
+        BOOST_TEST( above );
+    }
+
+    // malformed input
+
+    {
+        hyperloglog<int, xxhash_64, 10> s;
+
+        s.insert( 1 );
+        s.insert( 2 );
+
+        std::vector<unsigned char> w = serialize( s );
+
+        hyperloglog<int, xxhash_64, 10> s2;
+
+        BOOST_TEST( !s2.deserialize( w.data(), w.size() - 1 ) );
+        BOOST_TEST( !s2.deserialize( w.data(), 1 ) );
+
+        {
+            std::vector<unsigned char> w2( w );
+            w2[ 0 ] = 7;
+
+            BOOST_TEST( !s2.deserialize( w2.data(), w2.size() ) );
+        }
+
+        {
+            std::vector<unsigned char> w2( w );
+            w2[ 1 ] = 11;
+
+            BOOST_TEST( !s2.deserialize( w2.data(), w2.size() ) );
+        }
+
+        hyperloglog<int, xxhash_64, 11> s3;
+        BOOST_TEST( !s3.deserialize( w.data(), w.size() ) );
+
+        BOOST_TEST_EQ( s2.estimate(), 0 );
+    }
+
+    // different seeds produce different sketches
+
+    {
+        hyperloglog<int, xxhash_64> s1, s2( 7 );
+
+        for( int i = 0; i < 100; ++i )
+        {
+            s1.insert( i );
+            s2.insert( i );
+        }
+
+        BOOST_TEST( serialize( s1 ) != serialize( s2 ) );
+    }
+
+    return boost::report_errors();
+}
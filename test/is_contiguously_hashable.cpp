@@ -1,10 +1,12 @@
-// Copyright 2017, 2023 Peter Dimov.
+// Copyright 2017, 2023, 2025 Peter Dimov.
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/hash2/is_contiguously_hashable.hpp>
 #include <boost/hash2/endian.hpp>
 #include <boost/core/lightweight_test_trait.hpp>
+#include <utility>
+#include <array>
 #include <cstddef>
 
 class X;
@@ -170,5 +172,38 @@ int main()
 
     //
 
+    test<std::pair<char, unsigned char>, endian::native>( true );
+    test<std::pair<char, unsigned char>, endian::little>( true );
+    test<std::pair<char, unsigned char>, endian::big>( true );
+
+    test<std::pair<int, int>, endian::native>( true );
+    test<std::pair<int, int>, endian::little>( endian::native == endian::little );
+    test<std::pair<int, int>, endian::big>( endian::native == endian::big );
+
+    test<std::pair<int const, int>, endian::native>( true );
+    test<std::pair<int const, int>, endian::little>( endian::native == endian::little );
+    test<std::pair<int const, int>, endian::big>( endian::native == endian::big );
+
+    test<std::pair<char, int>, endian::native>( sizeof( std::pair<char, int> ) == sizeof( char ) + sizeof( int ) );
+    test<std::pair<int, float>, endian::native>( false );
+    test<std::pair<int, Y>, endian::native>( false );
+
+    //
+
+    test<std::array<char, 3>, endian::native>( true );
+    test<std::array<char, 3>, endian::little>( true );
+    test<std::array<char, 3>, endian::big>( true );
+
+    test<std::array<int, 4>, endian::native>( true );
+    test<std::array<int, 4>, endian::little>( endian::native == endian::little );
+    test<std::array<int, 4>, endian::big>( endian::native == endian::big );
+
+    test<std::array<std::pair<short, short>, 2>, endian::native>( true );
+
+    test<std::array<int, 0>, endian::native>( false );
+    test<std::array<double, 4>, endian::native>( false );
+
+    //
+
     return boost::report_errors();
 }
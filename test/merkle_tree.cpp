@@ -0,0 +1,205 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/merkle_tree.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <cstddef>
+
+// the RFC 6962 definition
+
+template<class Hash> typename Hash::result_type mth( std::vector<std::string> const& v, std::size_t first, std::size_t last )
+{
+    using mt = boost::hash2::merkle_tree<Hash>;
+
+    std::size_t n = last - first;
+
+    if( n == 0 ) return Hash().result();
+    if( n == 1 ) return mt::hash_leaf( v[ first ].data(), v[ first ].size() );
+
+    std::size_t k = 1;
+    while( k * 2 < n ) k *= 2;
+
+    auto l = mth<Hash>( v, first, first + k );
+    auto r = mth<Hash>( v, first + k, last );
+
+    unsigned char const prefix = 1;
+
+    Hash h;
+
+    h.update( &prefix, 1 );
+    h.update( l.data(), l.size() );
+    h.update( r.data(), r.size() );
+
+    return h.result();
+}
+
+// test vectors from the Certificate Transparency reference implementation
+
+void test_vectors()
+{
+    using boost::hash2::sha2_256;
+    using mt = boost::hash2::merkle_tree<sha2_256>;
+
+    std::vector<std::string> const leaves =
+    {
+        std::string( "", 0 ),
+        std::string( "\x00", 1 ),
+        std::string( "\x10", 1 ),
+        std::string( "\x20\x21", 2 ),
+        std::string( "\x30\x31", 2 ),
+        std::string( "\x40\x41\x42\x43", 4 ),
+        std::string( "\x50\x51\x52\x53\x54\x55\x56\x57", 8 ),
+        std::string( "\x60\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f", 16 ),
+    };
+
+    char const* const roots[] =
+    {
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "6e340b9cffb37a989ca544e6bb780a2c78901d3fb33738768511a30617afa01d",
+        "fac54203e7cc696cf0dfcb42c92a1d9dbaf70ad9e621f4bd8d98662f00e3c125",
+        "aeb6bcfe274b70a14fb067a5e5578264db0fa9b51af5e0ba159158f329e06e77",
+        "d37ee418976dd95753c1c73862b9398fa2a2cf9b4ff0fdfe8b30cd95209614b7",
+        "4e3bbb1f7b478dcfe71fb631631519a3bca12c9aefca1612bfce4c13a86264d4",
+        "76e67dadbcdf1e10e1b74ddc608abd2f98dfb16fbce75277b5232a127f2087ef",
+        "ddb89be403809e325750d3d263cd78929c2942b7942a34b77e122c9594a74c8c",
+        "5dc9da79a70659a9ad559cb701ded9a2ab9d823aad2f4960cfe370eff4604328",
+    };
+
+    mt t2;
+
+    BOOST_TEST_EQ( to_string( t2.root() ), std::string( roots[ 0 ] ) );
+
+    for( std::size_t n = 0; n <= leaves.size(); ++n )
+    {
+        mt t( leaves.begin(), leaves.begin() + n );
+
+        BOOST_TEST_EQ( t.size(), n );
+        BOOST_TEST_EQ( to_string( t.root() ), std::string( roots[ n ] ) );
+
+        if( n > 0 )
+        {
+            t2.push_back( leaves[ n - 1 ].data(), leaves[ n - 1 ].size() );
+            t2.commit();
+
+            BOOST_TEST_EQ( to_string( t2.root() ), std::string( roots[ n ] ) );
+        }
+    }
+}
+
+template<class Hash> void test_reference()
+{
+    using mt = boost::hash2::merkle_tree<Hash>;
+
+    std::vector<std::string> v;
+
+    for( std::size_t n = 0; n <= 70; ++n )
+    {
+        mt t( v.begin(), v.end() );
+
+        BOOST_TEST( t.root() == mth<Hash>( v, 0, n ) );
+
+        // inclusion proofs
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            std::vector<typename Hash::result_type> proof;
+            t.inclusion_proof( i, std::back_inserter( proof ) );
+
+            auto lh = mt::hash_leaf( v[ i ].data(), v[ i ].size() );
+
+            BOOST_TEST( mt::verify_inclusion( lh, i, n, proof.begin(), proof.end(), t.root() ) );
+
+            // wrong index, size, leaf, or proof
+
+            if( n > 1 )
+            {
+                BOOST_TEST( !mt::verify_inclusion( lh, ( i + 1 ) % n, n, proof.begin(), proof.end(), t.root() ) );
+                BOOST_TEST( !mt::verify_inclusion( mt::hash_leaf( "x", 1 ), i, n, proof.begin(), proof.end(), t.root() ) );
+                BOOST_TEST( !mt::verify_inclusion( lh, i, n, proof.begin(), proof.end() - 1, t.root() ) );
+            }
+
+            BOOST_TEST( !mt::verify_inclusion( lh, n, n, proof.begin(), proof.end(), t.root() ) );
+        }
+
+        v.push_back( std::to_string( n * 31 ) );
+    }
+}
+
+template<class Hash> void test_update()
+{
+    using mt = boost::hash2::merkle_tree<Hash>;
+
+    std::size_t const N = 1000;
+
+    std::vector<std::string> v;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        v.push_back( "block " + std::to_string( i ) );
+    }
+
+    mt t( v.begin(), v.end() );
+
+    BOOST_TEST( t.committed() );
+    BOOST_TEST( t.root() == mth<Hash>( v, 0, N ) );
+
+    BOOST_TEST_EQ( t.level_count(), 11u );
+    BOOST_TEST_EQ( t.level_size( 0 ), N );
+    BOOST_TEST_EQ( t.level_size( 10 ), 1u );
+    BOOST_TEST( t.node( 10, 0 ) == t.root() );
+
+    for( std::size_t r = 0; r < 10; ++r )
+    {
+        // a batch of updates, some of them to the same leaf
+
+        for( std::size_t j = 0; j < 50; ++j )
+        {
+            std::size_t i = ( j * 7919 + r * 104729 ) % N;
+
+            if( j % 10 == 0 ) i = N - 1;
+
+            v[ i ] = "block " + std::to_string( i ) + " version " + std::to_string( r * 100 + j );
+            t.update( i, v[ i ].data(), v[ i ].size() );
+        }
+
+        BOOST_TEST( !t.committed() );
+
+        t.commit();
+
+        BOOST_TEST( t.committed() );
+        BOOST_TEST( t.root() == mth<Hash>( v, 0, v.size() ) );
+        BOOST_TEST( t.root() == mt( v.begin(), v.end() ).root() );
+
+        // and appends
+
+        for( std::size_t j = 0; j < r; ++j )
+        {
+            v.push_back( "appended " + std::to_string( v.size() ) );
+            t.push_back( v.back().data(), v.back().size() );
+        }
+
+        t.commit();
+
+        BOOST_TEST_EQ( t.size(), v.size() );
+        BOOST_TEST( t.root() == mth<Hash>( v, 0, v.size() ) );
+    }
+}
+
+int main()
+{
+    test_vectors();
+
+    test_reference<boost::hash2::sha2_256>();
+    test_reference<boost::hash2::blake2b_512>();
+
+    test_update<boost::hash2::sha2_256>();
+    test_update<boost::hash2::blake2b_512>();
+
+    return boost::report_errors();
+}
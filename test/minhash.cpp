@@ -0,0 +1,129 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/minhash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+template<class S> void test( S const& s0 )
+{
+    // A = [0, 1000), B = [500, 1500), J(A, B) = 1/3
+
+    S a( s0 ), b( s0 ), c( s0 ), d( s0 );
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        a.insert( i );
+    }
+
+    std::vector<int> v;
+
+    for( int i = 500; i < 1500; ++i )
+    {
+        v.push_back( i );
+    }
+
+    b.insert( v.begin(), v.end() );
+
+    for( int i = 1500; i < 2500; ++i )
+    {
+        c.insert( i );
+    }
+
+    for( int i = 999; i >= 0; --i )
+    {
+        d.insert( i );
+        d.insert( i );
+    }
+
+    BOOST_TEST( a.signature() == d.signature() );
+    BOOST_TEST_EQ( a.jaccard( d ), 1.0 );
+
+    // the standard error is sqrt( J * (1 - J) / K ); allow five of them
+
+    double const K = static_cast<double>( S::signature_size );
+
+    BOOST_TEST_LE( std::abs( a.jaccard( b ) - 1.0 / 3 ), 5 * std::sqrt( 2.0 / 9 / K ) );
+    BOOST_TEST_LE( a.jaccard( c ), 5 / K );
+
+    // merge is the union
+
+    {
+        S e( a );
+        e.merge( b );
+
+        S f( s0 );
+
+        for( int i = 0; i < 1500; ++i )
+        {
+            f.insert( i );
+        }
+
+        BOOST_TEST( e.signature() == f.signature() );
+
+        // J(A, A u B) = 2/3
+        BOOST_TEST_LE( std::abs( a.jaccard( f ) - 2.0 / 3 ), 5 * std::sqrt( 2.0 / 9 / K ) );
+    }
+
+    // clear
+
+    {
+        S e( a );
+        e.clear();
+
+        BOOST_TEST( e.signature() == s0.signature() );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test( minhash<int, xxhash_64, 128>() );
+    test( minhash<int, xxhash_64, 256>( 7 ) );
+    test( minhash<int, siphash_64, 512, big_endian_flavor>( "seed", 4 ) );
+
+    // shingles
+
+    {
+        std::string s1 = "the quick brown fox jumps over the lazy dog, and then the quick brown fox jumps over the lazy dog again";
+        std::string s2 = "the quick brown fox jumped over the lazy dog, and then the quick brown fox jumps over the lazy dog again";
+        std::string s3 = "lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore";
+
+        minhash<char, xxhash_64, 256> m1, m2, m3;
+
+        m1.insert_shingles( s1.begin(), s1.end(), 5 );
+        m2.insert_shingles( s2.begin(), s2.end(), 5 );
+        m3.insert_shingles( s3.begin(), s3.end(), 5 );
+
+        BOOST_TEST_GT( m1.jaccard( m2 ), 0.7 );
+        BOOST_TEST_LT( m1.jaccard( m3 ), 0.1 );
+
+    }
+
+    // shorter than w, empty
+
+    {
+        std::vector<int> v{ 1, 2, 3 };
+
+        minhash<int, xxhash_64, 64> m1, m2, m3, m4;
+
+        m1.insert_shingles( v.begin(), v.end(), 5 );
+        m2.insert_shingles( v.begin(), v.end(), 3 );
+
+        BOOST_TEST( m1.signature() == m2.signature() );
+
+        m3.insert_shingles( v.begin(), v.begin(), 5 );
+
+        BOOST_TEST( m3.signature() == m4.signature() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,160 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/minimal_perfect_hash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+template<class F, class V> void test_bijection( F const& f, V const& v )
+{
+    BOOST_TEST_EQ( f.size(), v.size() );
+
+    std::vector<bool> seen( v.size() );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        std::size_t j = f( v[ i ] );
+
+        BOOST_TEST_LT( j, v.size() );
+
+        if( j < v.size() )
+        {
+            BOOST_TEST( !seen[ j ] );
+            seen[ j ] = true;
+        }
+    }
+}
+
+template<class H, class Fl = boost::hash2::default_flavor> void test( std::size_t n, std::uint64_t seed, double gamma )
+{
+    using F = boost::hash2::minimal_perfect_hash<std::string, H, Fl>;
+
+    std::vector<std::string> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v.push_back( "key_" + std::to_string( i ) );
+    }
+
+    F f( v.begin(), v.end(), seed, gamma );
+
+    test_bijection( f, v );
+
+    // other values map into [0, n)
+
+    if( n > 0 )
+    {
+        for( std::size_t i = 0; i < 1000; ++i )
+        {
+            BOOST_TEST_LT( f( "other_" + std::to_string( i ) ), n );
+        }
+    }
+
+    // the representation takes about gamma * e^(1/gamma) bits per key,
+    // plus 12.5% for the rank words
+
+    if( n >= 10000 )
+    {
+        BOOST_TEST_LT( 8.0 * f.byte_size() / n, 1.2 * gamma * std::exp( 1.0 / gamma ) );
+    }
+
+    // copy
+
+    {
+        F f2( f );
+        test_bijection( f2, v );
+
+        F f3;
+        BOOST_TEST_EQ( f3.size(), 0 );
+
+        f3 = f;
+        test_bijection( f3, v );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( f3( v[ i ] ), f( v[ i ] ) );
+        }
+    }
+
+    // serialization, view
+
+    {
+        std::vector<unsigned char> w( f.byte_size() );
+        f.serialize( w.data() );
+
+        BOOST_TEST( std::equal( w.begin(), w.end(), f.data() ) );
+
+        // the blocks are 64 byte aligned in the representation, and the
+        // representation is 64 byte aligned in memory
+
+        BOOST_TEST_EQ( reinterpret_cast<std::uintptr_t>( f.data() ) % 64, 0u );
+        BOOST_TEST_EQ( w.size() % 64, 0u );
+
+        F f2;
+        BOOST_TEST( f2.deserialize( w.data(), w.size() ) );
+
+        boost::hash2::minimal_perfect_hash_view<std::string, H, Fl> v2;
+        BOOST_TEST( v2.attach( w.data(), w.size() ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( f2( v[ i ] ), f( v[ i ] ) );
+            BOOST_TEST_EQ( v2( v[ i ] ), f( v[ i ] ) );
+        }
+
+        BOOST_TEST( !v2.attach( w.data(), w.size() - 8 ) );
+        BOOST_TEST( !v2.attach( w.data(), w.size() - 1 ) );
+        BOOST_TEST( !v2.attach( w.data(), 16 ) );
+
+        w[ 0 ] ^= 1;
+        BOOST_TEST( !f2.deserialize( w.data(), w.size() ) );
+        w[ 0 ] ^= 1;
+
+        if( n > 0 )
+        {
+            w[ w.size() - 1 ] ^= 1;
+            BOOST_TEST( !f2.deserialize( w.data(), w.size() ) );
+            w[ w.size() - 1 ] ^= 1;
+        }
+
+        // unchanged
+
+        BOOST_TEST_EQ( v2.size(), n );
+        BOOST_TEST_EQ( f2.size(), n );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    for( std::size_t n: { 0, 1, 2, 3, 10, 100, 1000, 10000, 100000 } )
+    {
+        test<xxhash_64>( n, 0, 2.0 );
+    }
+
+    test<siphash_64>( 10000, 7, 1.0 );
+    test<xxhash_64, big_endian_flavor>( 10000, 1, 3.0 );
+
+    // duplicates are treated as one key
+
+    {
+        std::vector<int> v{ 1, 2, 3, 2, 1 };
+
+        minimal_perfect_hash<int, xxhash_64> f( v.begin(), v.end() );
+
+        BOOST_TEST_EQ( f.size(), 3 );
+
+        std::vector<int> w{ 1, 2, 3 };
+        test_bijection( f, w );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,176 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/multiset_hash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+template<class Hash, class Flavor, class C> typename Hash::result_type hash_container( Hash h, C const& c )
+{
+    Flavor f{};
+    hash_append( h, f, c );
+
+    return h.result();
+}
+
+template<class Hash, class Flavor> void test_set()
+{
+    using ms = boost::hash2::multiset_hash<Hash, Flavor>;
+
+    std::unordered_multiset<int> s;
+    ms m;
+
+    BOOST_TEST_EQ( m.size(), 0u );
+    BOOST_TEST_EQ( m.sum(), 0u );
+    BOOST_TEST( m.result() == (hash_container<Hash, Flavor>( Hash(), s )) );
+
+    for( int i = 0; i < 100; ++i )
+    {
+        s.insert( i % 37 );
+        m.insert( i % 37 );
+
+        BOOST_TEST( m.result() == (hash_container<Hash, Flavor>( Hash(), s )) );
+    }
+
+    BOOST_TEST_EQ( m.size(), s.size() );
+
+    for( int i = 0; i < 50; ++i )
+    {
+        s.erase( s.find( i % 37 ) );
+        m.erase( i % 37 );
+
+        BOOST_TEST( m.result() == (hash_container<Hash, Flavor>( Hash(), s )) );
+    }
+
+    BOOST_TEST_EQ( m.size(), s.size() );
+
+    // insertion order doesn't matter
+
+    ms m2;
+    m2.insert( s.begin(), s.end() );
+
+    BOOST_TEST_EQ( m2.sum(), m.sum() );
+    BOOST_TEST( m2.result() == m.result() );
+
+    // erasing everything gives the empty multiset
+
+    m2.erase( s.begin(), s.end() );
+
+    BOOST_TEST_EQ( m2.size(), 0u );
+    BOOST_TEST_EQ( m2.sum(), 0u );
+    BOOST_TEST( m2.result() == ms().result() );
+
+    m.clear();
+
+    BOOST_TEST_EQ( m.size(), 0u );
+    BOOST_TEST( m.result() == ms().result() );
+}
+
+template<class Hash, class Flavor> void test_map()
+{
+    using ms = boost::hash2::multiset_hash<Hash, Flavor>;
+
+    std::unordered_map<std::string, int> s;
+    ms m( 7 );
+
+    for( int i = 0; i < 64; ++i )
+    {
+        std::pair<std::string const, int> v( std::to_string( i ), i * i );
+
+        s.insert( v );
+        m.insert( v );
+    }
+
+    BOOST_TEST( m.result() == (hash_container<Hash, Flavor>( Hash( 7 ), s )) );
+
+    // merge
+
+    ms m1( 7 ), m2( 7 );
+
+    for( auto const& v: s )
+    {
+        if( v.second % 2 ) m1.insert( v ); else m2.insert( v );
+    }
+
+    m1.merge( m2 );
+
+    BOOST_TEST_EQ( m1.size(), m.size() );
+    BOOST_TEST_EQ( m1.sum(), m.sum() );
+    BOOST_TEST( m1.result() == m.result() );
+}
+
+struct X
+{
+    int a;
+    std::unordered_set<std::string> b;
+};
+
+template<class Provider, class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Provider const& pr, Hash& h, Flavor const& f, X const* x )
+{
+    pr.hash_append( h, f, x->a );
+    pr.hash_append( h, f, x->b );
+}
+
+template<class Hash, class Flavor> void test_member()
+{
+    using ms = boost::hash2::multiset_hash<Hash, Flavor>;
+
+    X x = { 5, { "foo", "bar", "baz" } };
+
+    // the state of the hash algorithm after x.a
+
+    Hash h;
+    Flavor f{};
+
+    hash_append( h, f, x.a );
+
+    ms m( h );
+    m.insert( x.b.begin(), x.b.end() );
+
+    m.append_to( h );
+
+    BOOST_TEST( h.result() == (hash_container<Hash, Flavor>( Hash(), x )) );
+
+    x.b.insert( "quux" );
+    m.insert( std::string( "quux" ) );
+
+    // result() continues from the held state
+
+    BOOST_TEST( m.result() == (hash_container<Hash, Flavor>( Hash(), x )) );
+
+    Hash h2;
+    hash_append( h2, f, x.a );
+
+    m.append_to( h2 );
+
+    BOOST_TEST( h2.result() == (hash_container<Hash, Flavor>( Hash(), x )) );
+}
+
+template<class Hash, class Flavor> void test()
+{
+    test_set<Hash, Flavor>();
+    test_map<Hash, Flavor>();
+    test_member<Hash, Flavor>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_64, default_flavor>();
+    test<fnv1a_64, big_endian_flavor>();
+    test<xxhash_64, little_endian_flavor>();
+    test<xxhash_32, default_flavor>();
+    test<sha2_256, default_flavor>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,122 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class R> std::uint64_t hash_window( R r, unsigned char const* p )
+{
+    r.reset();
+
+    for( std::size_t i = 0; i < R::window_size; ++i )
+    {
+        r.push( p[ i ] );
+    }
+
+    return r.value();
+}
+
+template<class R> void test_roll( std::vector<unsigned char> const& v )
+{
+    constexpr std::size_t W = R::window_size;
+
+    R r( 0x0102030405060708ull );
+
+    for( std::size_t i = 0; i < W; ++i )
+    {
+        r.push( v[ i ] );
+    }
+
+    BOOST_TEST_EQ( r.value(), hash_window( r, v.data() ) );
+
+    for( std::size_t i = W; i < v.size(); ++i )
+    {
+        r.roll( v[ i - W ], v[ i ] );
+        BOOST_TEST_EQ( r.value(), hash_window( r, v.data() + i + 1 - W ) );
+    }
+}
+
+template<class R> void test_scan( std::vector<unsigned char> const& v, std::uint64_t mask )
+{
+    constexpr std::size_t W = R::window_size;
+
+    R r;
+
+    for( std::size_t n = 0; n <= v.size(); n += 37 )
+    {
+        std::vector<std::size_t> r1;
+
+        for( std::size_t i = W; i <= n; ++i )
+        {
+            if( ( hash_window( r, v.data() + i - W ) & mask ) == 0 )
+            {
+                r1.push_back( i );
+            }
+        }
+
+        std::vector<std::size_t> r2;
+
+        std::size_t k = r.scan( v.data(), n, mask, [&]( std::size_t i ){ r2.push_back( i ); } );
+
+        BOOST_TEST_EQ( k, r1.size() );
+        BOOST_TEST( r1 == r2 );
+
+        if( n >= W )
+        {
+            BOOST_TEST_EQ( r.value(), hash_window( r, v.data() + n - W ) );
+        }
+    }
+}
+
+template<class R> void test_seed( std::vector<unsigned char> const& v )
+{
+    unsigned char const seed[] = { 1, 2, 3, 4 };
+
+    std::uint64_t h0 = hash_window( R(), v.data() );
+
+    BOOST_TEST_EQ( hash_window( R( 0 ), v.data() ), h0 );
+    BOOST_TEST_EQ( hash_window( R( seed, 0 ), v.data() ), h0 );
+
+    BOOST_TEST_NE( hash_window( R( 1 ), v.data() ), h0 );
+    BOOST_TEST_NE( hash_window( R( seed, sizeof(seed) ), v.data() ), h0 );
+    BOOST_TEST_NE( hash_window( R( 1 ), v.data() ), hash_window( R( 2 ), v.data() ) );
+}
+
+template<class R> void test()
+{
+    std::vector<unsigned char> v( 1024 );
+
+    std::uint64_t x = 0;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( boost::hash2::detail::splitmix64( x ) );
+    }
+
+    test_roll<R>( v );
+    test_scan<R>( v, 0x0F );
+    test_scan<R>( v, 0 );
+    test_seed<R>( v );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test< rabin_karp_64<1> >();
+    test< rabin_karp_64<16> >();
+    test< rabin_karp_64<48> >();
+
+    test< buzhash_64<1> >();
+    test< buzhash_64<31> >();
+    test< buzhash_64<64> >();
+    test< buzhash_64<100> >();
+
+    test< gear_64 >();
+
+    return boost::report_errors();
+}
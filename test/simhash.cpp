@@ -0,0 +1,128 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/simhash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class S> void test( S const& s0 )
+{
+    S a( s0 ), b( s0 ), c( s0 ), d( s0 );
+
+    BOOST_TEST_EQ( a.value(), 0 );
+
+    std::vector<int> v;
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        a.insert( i );
+        v.push_back( i );
+    }
+
+    b.insert( v.begin(), v.end() );
+
+    BOOST_TEST_EQ( a.value(), b.value() );
+    BOOST_TEST_EQ( a.hamming_distance( b ), 0 );
+
+    // 5% different features
+
+    for( int i = 50; i < 1050; ++i )
+    {
+        c.insert( i );
+    }
+
+    // unrelated
+
+    for( int i = 5000; i < 6000; ++i )
+    {
+        d.insert( i );
+    }
+
+    BOOST_TEST_LT( a.hamming_distance( c ), 16 );
+    BOOST_TEST_GT( a.hamming_distance( d ), 16 );
+
+    // merge is the same as inserting the features of both
+
+    {
+        S e( s0 ), f( s0 ), g( s0 );
+
+        e.insert( v.begin(), v.begin() + 400 );
+        f.insert( v.begin() + 400, v.end() );
+
+        e.merge( f );
+
+        BOOST_TEST_EQ( e.value(), a.value() );
+
+        // weights
+
+        for( int i = 0; i < 400; ++i )
+        {
+            g.insert_weighted( i, 3 );
+        }
+
+        for( int i = 0; i < 400; ++i )
+        {
+            e.insert( i );
+            e.insert( i );
+        }
+
+        g.insert( v.begin() + 400, v.end() );
+
+        BOOST_TEST_EQ( e.value(), g.value() );
+
+        g.clear();
+        BOOST_TEST_EQ( g.value(), 0 );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test( simhash<int, xxhash_64>() );
+    test( simhash<int, xxhash_64>( 7 ) );
+    test( simhash<int, siphash_64, big_endian_flavor>( "seed", 4 ) );
+
+    // shingles
+
+    {
+        std::string s1 = "the quick brown fox jumps over the lazy dog, and then the quick brown fox jumps over the lazy dog again";
+        std::string s2 = "the quick brown fox jumped over the lazy dog, and then the quick brown fox jumps over the lazy dog again";
+
+        simhash<char, xxhash_64> h1, h2, h3;
+
+        h1.insert_shingles( s1.begin(), s1.end(), 4 );
+        h2.insert_shingles( s2.begin(), s2.end(), 4 );
+
+        BOOST_TEST_LT( h1.hamming_distance( h2 ), 16 );
+
+        for( std::size_t i = 0; i + 4 <= s1.size(); ++i )
+        {
+            h3.insert_shingles( s1.begin() + i, s1.begin() + i + 4, 4 );
+        }
+
+        BOOST_TEST_EQ( h1.value(), h3.value() );
+    }
+
+    // different seeds produce different fingerprints
+
+    {
+        simhash<int, xxhash_64> h1, h2( 7 );
+
+        for( int i = 0; i < 100; ++i )
+        {
+            h1.insert( i );
+            h2.insert( i );
+        }
+
+        BOOST_TEST_NE( h1.value(), h2.value() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,125 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/static_map.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <utility>
+#include <cstddef>
+
+template<class Hash> void test_keywords()
+{
+    using boost::hash2::static_map;
+
+    std::pair<std::string, int> const a[] =
+    {
+        { "if", 1 }, { "else", 2 }, { "while", 3 }, { "for", 4 }, { "do", 5 },
+        { "switch", 6 }, { "case", 7 }, { "default", 8 }, { "break", 9 }, { "continue", 10 },
+        { "return", 11 }, { "goto", 12 }, { "try", 13 }, { "catch", 14 }, { "throw", 15 },
+        { "struct", 16 }, { "class", 17 }, { "union", 18 }, { "enum", 19 }, { "namespace", 20 },
+    };
+
+    constexpr std::size_t N = sizeof( a ) / sizeof( a[0] );
+
+    static_map<std::string, int, N, Hash> m( a );
+
+    BOOST_TEST_EQ( m.size(), N );
+    BOOST_TEST_EQ( decltype( m )::table_size, 32u );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        int const* p = m.find( a[ i ].first );
+
+        BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, a[ i ].second );
+        BOOST_TEST( m.contains( a[ i ].first ) );
+        BOOST_TEST_EQ( m.value_or( a[ i ].first, -1 ), a[ i ].second );
+    }
+
+    BOOST_TEST( m.find( "" ) == nullptr );
+    BOOST_TEST( m.find( "iff" ) == nullptr );
+    BOOST_TEST( m.find( "If" ) == nullptr );
+    BOOST_TEST( !m.contains( "auto" ) );
+    BOOST_TEST_EQ( m.value_or( "static", -1 ), -1 );
+
+    // a different starting seed gives the same mapping
+
+    static_map<std::string, int, N, Hash> m2( a, 12345 );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( m2.value_or( a[ i ].first, -1 ), a[ i ].second );
+    }
+}
+
+template<class Hash> void test_large()
+{
+    using boost::hash2::static_map;
+
+    constexpr std::size_t N = 1000;
+
+    static std::pair<std::uint64_t, std::uint64_t> a[ N ];
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        a[ i ] = { i * 7919, i };
+    }
+
+    static_map<std::uint64_t, std::uint64_t, N, Hash> m( a );
+
+    BOOST_TEST_EQ( m.size(), N );
+    BOOST_TEST_EQ( decltype( m )::table_size, 1024u );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( m.value_or( i * 7919, N ), i );
+        BOOST_TEST( !m.contains( i * 7919 + 1 ) );
+    }
+}
+
+void test_duplicates()
+{
+    using boost::hash2::static_map;
+    using boost::hash2::make_static_map;
+
+    std::pair<int, int> const a[] = { { 1, 1 }, { 2, 2 }, { 1, 3 }, { 3, 4 }, { 1, 5 } };
+
+    auto m = make_static_map( a );
+
+    BOOST_TEST_EQ( m.size(), 3u );
+    BOOST_TEST_EQ( m.value_or( 1, 0 ), 1 );
+    BOOST_TEST_EQ( m.value_or( 2, 0 ), 2 );
+    BOOST_TEST_EQ( m.value_or( 3, 0 ), 4 );
+    BOOST_TEST_EQ( m.value_or( 4, 0 ), 0 );
+}
+
+void test_single()
+{
+    using boost::hash2::static_map;
+
+    std::pair<int, int> const a[] = { { 5, 7 } };
+
+    static_map<int, int, 1> m( a );
+
+    BOOST_TEST_EQ( m.size(), 1u );
+    BOOST_TEST_EQ( m.value_or( 5, 0 ), 7 );
+    BOOST_TEST( !m.contains( 0 ) );
+}
+
+int main()
+{
+    test_keywords<boost::hash2::fnv1a_64>();
+    test_keywords<boost::hash2::xxhash_64>();
+    test_keywords<boost::hash2::siphash_64>();
+
+    test_large<boost::hash2::fnv1a_64>();
+    test_large<boost::hash2::xxhash_64>();
+
+    test_duplicates();
+    test_single();
+
+    return boost::report_errors();
+}
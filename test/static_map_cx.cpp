@@ -0,0 +1,106 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/static_map.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <utility>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR) || ( defined(BOOST_GCC) && BOOST_GCC < 60000 )
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX14_CONSTEXPR is defined" )
+int main() {}
+
+#else
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+# include <string_view>
+#endif
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using boost::hash2::make_static_map;
+
+constexpr std::pair<int, int> codes[] =
+{
+    { 100, 1 }, { 200, 2 }, { 204, 3 }, { 301, 4 }, { 302, 5 },
+    { 304, 6 }, { 400, 7 }, { 401, 8 }, { 403, 9 }, { 404, 10 },
+    { 500, 11 }, { 502, 12 }, { 503, 13 },
+};
+
+constexpr auto m1 = make_static_map( codes );
+constexpr auto m2 = make_static_map<int, int, boost::hash2::xxhash_64>( codes );
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+enum class command { none, get, set, del, incr, decr, quit };
+
+constexpr auto m3 = make_static_map<std::string_view, command>( {
+    { "GET", command::get },
+    { "SET", command::set },
+    { "DEL", command::del },
+    { "INCR", command::incr },
+    { "DECR", command::decr },
+    { "QUIT", command::quit },
+} );
+
+constexpr auto m4 = make_static_map<std::string_view, command, boost::hash2::xxhash_64>( {
+    { "GET", command::get },
+    { "SET", command::set },
+    { "DEL", command::del },
+    { "INCR", command::incr },
+    { "DECR", command::decr },
+    { "QUIT", command::quit },
+} );
+
+#endif
+
+int main()
+{
+    STATIC_ASSERT( m1.size() == 13 );
+    STATIC_ASSERT( m1.value_or( 100, 0 ) == 1 );
+    STATIC_ASSERT( m1.value_or( 304, 0 ) == 6 );
+    STATIC_ASSERT( m1.value_or( 503, 0 ) == 13 );
+    STATIC_ASSERT( m1.value_or( 505, 0 ) == 0 );
+    STATIC_ASSERT( !m1.contains( 0 ) );
+
+    STATIC_ASSERT( m2.size() == 13 );
+    STATIC_ASSERT( m2.value_or( 200, 0 ) == 2 );
+    STATIC_ASSERT( m2.value_or( 404, 0 ) == 10 );
+    STATIC_ASSERT( !m2.contains( 405 ) );
+
+    for( auto const& x: codes )
+    {
+        BOOST_TEST_EQ( m1.value_or( x.first, 0 ), x.second );
+        BOOST_TEST_EQ( m2.value_or( x.first, 0 ), x.second );
+    }
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+    STATIC_ASSERT( m3.size() == 6 );
+    STATIC_ASSERT( m3.value_or( "GET", command::none ) == command::get );
+    STATIC_ASSERT( m3.value_or( "QUIT", command::none ) == command::quit );
+    STATIC_ASSERT( m3.value_or( "get", command::none ) == command::none );
+    STATIC_ASSERT( m3.value_or( "", command::none ) == command::none );
+
+    STATIC_ASSERT( m4.value_or( "INCR", command::none ) == command::incr );
+    STATIC_ASSERT( m4.value_or( "DECR", command::none ) == command::decr );
+    STATIC_ASSERT( !m4.contains( "DECRBY" ) );
+
+    BOOST_TEST( m3.value_or( "SET", command::none ) == command::set );
+    BOOST_TEST( m4.value_or( "DEL", command::none ) == command::del );
+
+#endif
+
+    return boost::report_errors();
+}
+
+#endif
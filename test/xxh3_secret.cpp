@@ -0,0 +1,118 @@
+// Copyright 2025 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::xxh3_128;
+using boost::hash2::xxh3_128_shared;
+using boost::hash2::xxh3_secret;
+
+static std::vector<unsigned char> make_test_bytes( std::size_t n )
+{
+    std::vector<unsigned char> v( n, 0 );
+
+    std::uint64_t gen = 2654435761u;
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( gen >> 56 );
+        gen *= 11400714785074694797ull;
+    }
+
+    return v;
+}
+
+// compares h1 and h2 over all input lengths up to 2048, hashing the
+// input at once and in two parts, and the extended result
+
+static void test( xxh3_128 const& h1, xxh3_128_shared const& h2 )
+{
+    auto const v = make_test_bytes( 2048 );
+
+    for( std::size_t n = 0; n <= v.size(); n += ( n < 300? 1: 61 ) )
+    {
+        {
+            xxh3_128 a( h1 );
+            xxh3_128_shared b( h2 );
+
+            a.update( v.data(), n );
+            b.update( v.data(), n );
+
+            BOOST_TEST( a.result() == b.result() );
+            BOOST_TEST( a.result() == b.result() );
+        }
+
+        {
+            xxh3_128 a( h1 );
+            xxh3_128_shared b( h2 );
+
+            std::size_t m = n / 3;
+
+            a.update( v.data(), n );
+
+            b.update( v.data(), m );
+            b.update( v.data() + m, n - m );
+
+            BOOST_TEST( a.result() == b.result() );
+        }
+    }
+}
+
+int main()
+{
+    auto const secret = make_test_bytes( 256 );
+
+    test( xxh3_128(), xxh3_128_shared( xxh3_secret() ) );
+
+    for( std::uint64_t seed: { 0ull, 1ull, 0x9e3779b1ull, 0x9e3779b185ebca8dull } )
+    {
+        xxh3_secret const s( seed );
+
+        test( xxh3_128( seed ), xxh3_128_shared( s ) );
+
+        xxh3_secret const s2 = xxh3_secret::with_seed( seed );
+
+        test( xxh3_128::with_seed( seed ), xxh3_128_shared( s2 ) );
+    }
+
+    for( std::size_t n: { 0, 1, 7, 64, 135, 136, 150, 192, 193, 256 } )
+    {
+        {
+            xxh3_secret const s( secret.data(), n );
+            test( xxh3_128( secret.data(), n ), xxh3_128_shared( s ) );
+        }
+
+        {
+            xxh3_secret const s = xxh3_secret::with_secret( secret.data(), n );
+            test( xxh3_128::with_secret( secret.data(), n ), xxh3_128_shared( s ) );
+        }
+
+        {
+            xxh3_secret const s = xxh3_secret::with_secret_and_seed( secret.data(), n, 0x9e3779b1 );
+            test( xxh3_128::with_secret_and_seed( secret.data(), n, 0x9e3779b1 ), xxh3_128_shared( s ) );
+        }
+    }
+
+    // the shared variant doesn't carry a secret of its own
+
+    BOOST_TEST_LE( sizeof( xxh3_128_shared ) + 192, sizeof( xxh3_128 ) + sizeof( void const* ) );
+
+    // many hashers share a secret
+
+    {
+        xxh3_secret const s( 0x9e3779b185ebca8dull );
+
+        std::vector<xxh3_128_shared> v( 4, xxh3_128_shared( s ) );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            test( xxh3_128( 0x9e3779b185ebca8dull ), v[ i ] );
+        }
+    }
+
+    return boost::report_errors();
+}